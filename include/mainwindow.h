@@ -3,7 +3,9 @@
 
 #include "matrixload.h"
 #include "matrixinput.h"
-#include "MatrixChainSolve.h"
+#include "matrixchainsolve.h"
+#include "matrixchainverify.h"
+#include "matrixchaindistribute.h"
 
 #include <QMainWindow>
 #include <QVector>
@@ -40,6 +42,8 @@ private:
     MatrixChainSolve *matrixSolve;
     MatrixLoad *matrixLoad;
     MatrixInput *matrixInput;
+    MatrixChainVerify *matrixVerify;
+    MatrixChainDistribute *matrixDistribute;
 
 };
 
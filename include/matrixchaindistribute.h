@@ -0,0 +1,135 @@
+#ifndef MATRIXCHAINDISTRIBUTE_H
+#define MATRIXCHAINDISTRIBUTE_H
+
+#include "matrixchainsolve.h"
+
+#include <QVector>
+#include <QString>
+#include <QByteArray>
+#include <QHash>
+#include <functional>
+#include <memory>
+
+// Abstract channel used to exchange operands and results between the master and a worker process.
+// Every message is a flat vector of integers, so any backend only has to move framed int buffers.
+// The worker end is described by an endpoint "scheme:address" that is passed to the worker process on its command line,
+// where the transport registered for the scheme opens it again.
+class MatrixTransport {
+public:
+    virtual ~MatrixTransport() = default;
+
+    virtual bool sendMessage(const QVector<int> &message) = 0;  // Sends one whole message
+    virtual bool receiveMessage(QVector<int> &message) = 0;     // Blocks until one whole message is received
+    virtual QByteArray endpoint() const = 0;                    // Endpoint the worker process opens this end with
+    virtual void keepAcrossExec() {}                            // Called in the forked child before the worker is executed
+};
+
+#ifdef Q_OS_UNIX
+// Transport backend over a connected Unix domain socket, so everything can be run on a single Linux box
+class UnixSocketTransport : public MatrixTransport {
+public:
+    explicit UnixSocketTransport(int fd);
+    ~UnixSocketTransport() override;
+
+    bool sendMessage(const QVector<int> &message) override;
+    bool receiveMessage(QVector<int> &message) override;
+    QByteArray endpoint() const override;
+    void keepAcrossExec() override;
+
+    // Creates a connected pair of transports, one for the master and one for the worker side
+    static bool createPair(std::unique_ptr<MatrixTransport> &masterEnd, std::unique_ptr<MatrixTransport> &workerEnd);
+    // Opens the worker end inside the worker process from the descriptor number of the endpoint
+    static std::unique_ptr<MatrixTransport> open(const QByteArray &address);
+private:
+    int socketFd;   // File descriptor of the socket end owned by this transport
+
+    bool writeAll(const void *buffer, size_t size);
+    bool readAll(void *buffer, size_t size);
+};
+#endif // Q_OS_UNIX
+
+// Evaluates the optimal parenthesization tree across worker processes.
+// Subtrees of the order table are mapped to workers, and large multiplications above them are computed SUMMA style
+// as 2D tiles that the workers accumulate from streamed panels of the shared dimension.
+// Every subtree result and tile is sent back to the master, which packs the operands of all later products, so no data
+// stays on a worker between two products. Moving the data is only counted as load of the worker that receives it.
+// The workers run the same executable started with the worker argument, main has to hand those over to runWorkerProcess.
+// Workers are started with fork and exec, on other platforms than Unix the chain is always solved locally.
+class MatrixChainDistribute {
+public:
+    // Factory creating a connected master/worker transport pair for each spawned worker.
+    // The master end must not be inherited by other workers, the worker end is passed on by its endpoint.
+    using TransportFactory = std::function<bool(std::unique_ptr<MatrixTransport> &, std::unique_ptr<MatrixTransport> &)>;
+    // Factory opening the worker end inside the worker process from the address part of its endpoint
+    using WorkerTransportFactory = std::function<std::unique_ptr<MatrixTransport>(const QByteArray &)>;
+
+    MatrixChainDistribute(MatrixChainSolve *solve, int numWorkers = 0);
+
+    QVector<QVector<int>> solveMatrices();  // Calculate the final matrix result using the worker processes
+
+    static bool isAvailable();              // Returns true if worker processes can be started on this platform
+
+    // Entry point of the worker processes
+    static bool isWorkerProcess(int argc, char *argv[]);
+    static int runWorkerProcess(char *argv[]);
+    // Registers the worker side of a transport backend, the "unix" scheme is always available.
+    // Has to be called in the worker process too, before runWorkerProcess.
+    static void registerWorkerTransport(const QByteArray &scheme, const WorkerTransportFactory &factory);
+
+    // Declare the setters for the tuning parameters
+    void setNumWorkers(int workers);
+    void setWorkerProgram(const QString &program);
+    void setTransportFactory(const TransportFactory &factory);
+    void setCommWeight(int weight);
+    void setTileThreshold(long long threshold);
+    void setPanelWidth(int width);
+
+    // Declare the getters for the outcome of the last solveMatrices call
+    const QString& getLastError() const;
+    int getNumSubtrees() const;
+    int getNumTiles() const;
+private:
+    // A subtree of the order table that is computed completely by one worker
+    struct ChainTask {
+        int first;      // Index of the first matrix of the subchain
+        int last;       // Index of the last matrix of the subchain
+        int worker;     // Worker the subchain is mapped to
+    };
+
+    // One worker process and the master side of its transport
+    struct Worker {
+        qint64 pid;
+        std::unique_ptr<MatrixTransport> transport;
+    };
+
+    static const char *WORKER_ARGUMENT;     // Command line argument that starts the executable as a worker
+
+    MatrixChainSolve *matrixSolve;          // Declare the pointer variable pointing to the MatrixChainSolve object
+    int numWorkers;                         // Number of worker processes to spawn
+    int commWeight;                         // Estimated cost of moving one element compared to one multiplication
+    long long tileThreshold;                // Minimal number of multiplications of a product before it is tiled
+    int panelWidth;                         // Width of the shared dimension panels streamed to each tile
+    QString workerProgram;                  // Executable started for the workers, empty for this application
+    TransportFactory transportFactory;      // Creates the transports for new workers
+    std::vector<Worker> workers;            // Running worker processes
+    QVector<QVector<int>> subResults;       // Flattened results of the subtrees, indexed by first * size + last
+    QVector<QVector<int>> subDims;          // Rows and columns of each stored subtree result
+    QString lastError;                      // Why the last call fell back to solving locally, empty if it didn't
+    int numSubtrees;                        // Subtrees computed by the workers in the last call
+    int numTiles;                           // Tiles computed by the workers in the last call
+
+    QVector<ChainTask> planSubtrees();                                  // Cut the order tree into subtrees
+    void assignWorkers(QVector<ChainTask> &tasks);                      // Balance the subtrees over the workers
+    long long commVolume(int i, int j) const;                           // Elements sent to and from the worker of subchain i..j
+    bool startWorkers();                                                // Spawn the worker processes
+    void stopWorkers();                                                 // Tell the workers to exit and wait for them
+    bool runChainTasks(const QVector<ChainTask> &tasks);                // Compute the subtrees on the workers
+    bool combine(int i, int j, QVector<int> &result, int &rows, int &cols);  // Evaluate the tree above the subtrees
+    bool multiplyTiled(const QVector<int> &left, const QVector<int> &right,
+                       int rows, int shared, int cols, QVector<int> &result); // SUMMA style 2D tiled product
+
+    static void runWorker(MatrixTransport &transport);                  // Message loop executed inside a worker process
+    static QHash<QByteArray, WorkerTransportFactory> &workerTransports(); // Registered worker transports by scheme
+};
+
+#endif // MATRIXCHAINDISTRIBUTE_H
@@ -0,0 +1,31 @@
+#ifndef MATRIXCHAINLAZY_H
+#define MATRIXCHAINLAZY_H
+
+#include "matrixchainsolve.h"
+
+#include <QVector>
+
+// Lazy handle to the result of the chain. Nothing is computed until a part of the result is asked for, and every query
+// re-plans the multiplication order for the narrowed chain so only the requested rows, columns or product are computed.
+// It is meant for code that needs parts of the result, the main window computes the whole product since it verifies it.
+class MatrixChainLazy {
+public:
+    MatrixChainLazy(MatrixChainSolve *solve);
+
+    QVector<int> row(int r);                                    // Row r of the result
+    QVector<int> col(int c);                                    // Column c of the result
+    QVector<QVector<int>> block(int r0, int c0, int h, int w);  // h x w block of the result starting at row r0, column c0
+    QVector<int> apply(const QVector<int> &vect);               // Result multiplied with a vector
+
+    // Declare the getters for the size of the result and the cost of the last query
+    int getNumRows() const;
+    int getNumCols() const;
+    int getLastCost() const;
+private:
+    MatrixChainSolve *matrixSolve;  // Declare the pointer variable pointing to the MatrixChainSolve object
+    int lastCost;                   // Minimal multiplication cost of the chain planned for the last query
+
+    QVector<QVector<int>> solveChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols); // Plan and compute a modified chain
+};
+
+#endif // MATRIXCHAINLAZY_H
@@ -7,6 +7,7 @@ class MatrixChainSolve {
 public:
     QVector<QVector<int>> solveMatrices();
     QString getOptParenthesization();
+    void optimalOrderCost();                                        // Calculate the optimal multiplication order and cost
 
     // Declare the getters for the member variables
     const QVector<QVector<int>>& getAllMatrices() const;
@@ -26,7 +27,6 @@ private:
     QVector<QVector<int>> cost, order;  // Minimal costs and optimal order vectors
     QVector<QVector<int>> optimalMultiplication(int i, int j);      // Calculation of the final matrix result
 
-    void optimalOrderCost();                                        // Calculate the optimal multiplication order and cost
     void calcParens(int i, int j, QString &parens);                 // Calculate the Optimal Parenthesization
 };
 
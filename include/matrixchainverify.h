@@ -0,0 +1,40 @@
+#ifndef MATRIXCHAINVERIFY_H
+#define MATRIXCHAINVERIFY_H
+
+#include <QVector>
+
+// Randomized (Freivalds) check of a chain product. Instead of recomputing the product, random vectors are multiplied
+// through the chain from right to left and compared with the result times the same vectors.
+class MatrixChainVerify {
+public:
+    // How the two sides are compared
+    enum Mode {
+        Exact,      // Integer arithmetic that wraps around like the int result, at most 1/2 false positives per vector
+        Modular,    // Arithmetic modulo a large prime, at most 1/MODULUS false positives per vector, reports overflowed results
+        Tolerance   // Floating point arithmetic, entries may differ by the tolerance relative to their magnitude
+    };
+
+    MatrixChainVerify(Mode mode = Exact, double falsePositiveBound = 1e-9);
+
+    // Checks the result against the original chain, returns false if the result is wrong
+    bool verify(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols, const QVector<QVector<int>> &result) const;
+
+    // Declare the setters and getters for the member variables
+    void setMode(Mode mode);
+    void setFalsePositiveBound(double bound);
+    void setTolerance(double tol);
+    Mode getMode() const;
+    int getNumTrials() const;   // Number of random vectors needed to stay below the false positive bound
+private:
+    static const quint64 MODULUS;   // Prime used for the modular comparison
+
+    Mode verifyMode;                // Comparison used by verify
+    double falsePositiveBound;      // Highest accepted probability that a wrong result passes
+    double tolerance;               // Relative tolerance of the floating point comparison
+
+    bool verifyExact(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols, const QVector<QVector<int>> &result) const;
+    bool verifyModular(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols, const QVector<QVector<int>> &result) const;
+    bool verifyTolerance(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols, const QVector<QVector<int>> &result) const;
+};
+
+#endif // MATRIXCHAINVERIFY_H
@@ -2,7 +2,7 @@
 #define MATRIXINPUT_H
 
 #include "matrixload.h"
-#include "MatrixChainSolve.h"
+#include "matrixchainsolve.h"
 
 class MatrixInput
 {
@@ -0,0 +1,64 @@
+#ifndef MATRIXSTORE_H
+#define MATRIXSTORE_H
+
+#include <QVector>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+
+// Repository of saved matrix chains. Every distinct matrix is stored once in the objects folder under its content hash,
+// and an append only index file maps each chain id to the chain hash and the hashes of its matrices.
+// Appends are done under a lock file, so several running programs can share the same store.
+// Chains saved in a transaction are marked as pending in the index until they are committed, until then other programs
+// don't reuse or load them, so undoing a transaction never removes a chain another program relies on.
+class MatrixStore {
+public:
+    MatrixStore(const QString &folderName);
+
+    int saveChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols, bool &isNewChain); // Saves a chain and returns its id
+    bool loadChain(int id, QVector<QVector<int>> &matrices, QVector<int> &rowsCols);            // Loads the chain with the given id
+    int findChain(const QString &chainHash);                                                   // Finds the id of a chain by its hash
+    QString getIndexPath() const;                                                               // Getter for the path of the index file
+
+    static QString hashChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols); // Content hash of a whole chain
+
+    void setCompression(bool isEnabled);    // Compress the matrix objects that are written from now on
+
+    // Saves between beginTransaction and commit can be undone with rollback
+    void beginTransaction();
+    bool commit();
+    bool rollback();
+    bool hasPendingChanges() const;
+private:
+    static const QString INDEX_FILE_NAME;       // String to hold the name of the index file
+    static const QString LOCK_FILE_NAME;        // String to hold the name of the lock file of the index
+    static const QString OBJECTS_FOLDER_NAME;   // String to hold the name of the folder with the matrix objects
+    static const int LOCK_TIMEOUT;              // Milliseconds to wait for the lock of the index
+
+    QString folderName;                         // Folder that holds the index and the objects
+    bool isCompressed;                          // If new objects are written compressed
+    qint64 indexReadSize;                       // Bytes of the index file that were already read into memory
+    int nextID;                                 // Id of the next saved chain
+    QHash<QString, int> chainIDs;               // Chain hash to chain id
+    QHash<int, QStringList> chainMatrices;      // Chain id to the hashes of its matrices
+    QSet<int> pendingChains;                    // Chains of other programs that aren't committed yet
+
+    bool isInTransaction;                       // If a transaction is open
+    QVector<int> txChains;                      // Chains saved in the transaction
+    QStringList txObjects;                      // Matrix objects written in the transaction
+
+    void readIndex(bool isLocked);                                                  // Reads the new lines of the index file
+    void addChainID(const QString &chainHash, int id);                              // Makes a chain findable by its hash
+    void endTransaction();                                                          // Forgets the transaction
+    bool appendIndex(const QByteArray &lines);                                      // Appends lines to the index file
+    bool writeObject(const QString &hash, const QVector<int> &matr, int numRows, int numCols); // Writes one matrix object
+    bool readObject(const QString &hash, QVector<int> &matr, int &numRows, int &numCols);      // Reads one matrix object
+    bool hasObject(const QString &hash) const;                                      // Checks if a matrix object is stored
+    QString objectPath(const QString &hash, bool isCompressedObject) const;         // Path of a matrix object file
+
+    static QString hashMatrix(const QVector<int> &matr, int numRows, int numCols);  // Content hash of one matrix
+    static QString hashChain(const QStringList &matrixHashes);                      // Content hash of the matrix hashes
+};
+
+#endif // MATRIXSTORE_H
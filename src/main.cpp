@@ -1,4 +1,5 @@
 #include "mainwindow.h"
+#include "matrixchaindistribute.h"
 
 #include <QApplication>
 #include <QLocale>
@@ -6,6 +7,11 @@
 
 int main(int argc, char *argv[])
 {
+    // The worker processes of MatrixChainDistribute run this executable again, without the window
+    if (MatrixChainDistribute::isWorkerProcess(argc, argv)) {
+        return MatrixChainDistribute::runWorkerProcess(argv);
+    }
+
     QApplication a(argc, argv);
 
     QTranslator translator;
@@ -2,7 +2,7 @@
 #include "ui_mainwindow.h"
 #include "matrixload.h"
 #include "matrixinput.h"
-#include "MatrixChainSolve.h"
+#include "matrixchainsolve.h"
 #include <QFileDialog>          // For file dialog handling
 #include <QMessageBox>         // For displaying Q message boxes
 
@@ -14,6 +14,11 @@ MainWindow::MainWindow(QWidget *parent)
     matrixSolve = new MatrixChainSolve();
     matrixLoad = new MatrixLoad(matrixSolve);
     matrixInput = new MatrixInput(matrixSolve, matrixLoad);
+    matrixVerify = new MatrixChainVerify();
+    matrixDistribute = new MatrixChainDistribute(matrixSolve);
+
+    // All matrices saved during this run are kept only if the ok button is clicked
+    matrixLoad->getStore().beginTransaction();
 
     ui->setupUi(this);
 
@@ -30,6 +35,9 @@ MainWindow::MainWindow(QWidget *parent)
 
     // Disable the solve matrix button until a file is loaded or the user has put an input
     ui->solveMatrButton->setEnabled(false);
+    // Worker processes can only be chosen where they can be started, elsewhere the spin box stays at none
+    ui->workersLabel->setVisible(MatrixChainDistribute::isAvailable());
+    ui->workersSpinBox->setVisible(MatrixChainDistribute::isAvailable());
     // Set default text in parenthesizationLabel
     ui->parenthesizationLabel->setText("Optimal Parenthesization:");
 
@@ -44,11 +52,15 @@ MainWindow::MainWindow(QWidget *parent)
 }
 
 MainWindow::~MainWindow() {
+    // Closing the window keeps the saved matrices like the ok button, unless they were undone with cancel
+    matrixLoad->getStore().commit();
     delete ui;
     // Delete the created object pointers stored in the heap when the program is closed
     delete matrixLoad;
     delete matrixInput;
     delete matrixSolve;
+    delete matrixVerify;
+    delete matrixDistribute;
 }
 
 // This slot function opens and loads Matrices from a file, if the matrices were loaded correctly it enables the Solve matrix button
@@ -75,9 +87,23 @@ void MainWindow::inputMatr() {
 
 // This function solves the matrix chain multiplication problem, the optimal order and minimal cost using the stored matrices.
 // It then displays the optimal multiplication order, minimal cost and final resulting matrix in the UI tables.
+// In case worker processes are chosen the chain is solved by them, otherwise it is solved locally.
+// The final result is checked against the original chain with random vectors instead of recomputing it.
 // The function is void so it has no return value and it has no input parameters
 void MainWindow::solveMatrices() {
-    QVector<QVector<int>> matrRes = matrixSolve->solveMatrices();
+    QVector<QVector<int>> matrRes;
+    if (ui->workersSpinBox->value() > 0) {
+        matrixDistribute->setNumWorkers(ui->workersSpinBox->value());
+        matrRes = matrixDistribute->solveMatrices();  // Falls back to solving locally if the workers fail
+        if (!matrixDistribute->getLastError().isEmpty()) {
+            QMessageBox::warning(this, "Worker Error", matrixDistribute->getLastError());
+        }
+    } else {
+        matrRes = matrixSolve->solveMatrices();
+    }
+    if (!matrixVerify->verify(matrixSolve->getAllMatrices(), matrixSolve->getMatrRowsCols(), matrRes)) {
+        QMessageBox::warning(this, "Verification Error", "The result of the multiplication doesn't match the matrix chain.");
+    }
     visualizeOrderCost();           // Print the results in the two tables
     displayMatrResult(matrRes);    // Print the final matrix result
     displayOptParenthesization(); // Print the optimal parenthesization
@@ -137,17 +163,21 @@ void MainWindow::displayMatrResult(const QVector<QVector<int>> &matr) {
 // This function keeps all saved data in case ok is clicked
 // The function is void so it has no return value and it has no input parameters
 void MainWindow::okButton() {
-    // When the ok button is clicked the program is closed
+    // When the ok button is clicked the saved matrices are kept and the program is closed
+    if (!matrixLoad->getStore().commit()) {
+        QMessageBox::warning(this, "Error", "Couldn't keep the saved matrices.");
+        return;
+    }
     QApplication::quit(); // Close the program
 }
 
-// This function deletes all saved files in the directory for the current run of the program
+// This function undoes all matrices saved in the chain store for the current run of the program
 // The function is void so it has no return value and it has no input parameters
 void MainWindow::cancelButton() {
-    const QVector<QString>& savedFiles = matrixLoad->getSavedFiles();
+    MatrixStore& matrixStore = matrixLoad->getStore();
 
-    // Check if the savedFiles vector is empty
-    if (savedFiles.isEmpty()) {
+    // Check if any matrices were saved during this run
+    if (!matrixStore.hasPendingChanges()) {
         // If no files were saved, close the program directly
         QApplication::quit(); // Close the program
     } else {
@@ -158,9 +188,10 @@ void MainWindow::cancelButton() {
                                        QMessageBox::Yes | QMessageBox::No);
 
         if (answer == QMessageBox::Yes) {
-            // Loop through all saved file paths in the savedFiles vector
-            for (int i = 0; i < savedFiles.size(); ++i) {
-                QFile::remove(savedFiles[i]);  // Remove the current saved file
+            // Mark the matrices saved during this run as deleted and remove the files only they used
+            if (!matrixStore.rollback()) {
+                QMessageBox::warning(this, "Error", "Couldn't undo the saved matrices.");
+                return;
             }
 
             QApplication::quit(); // Close the program
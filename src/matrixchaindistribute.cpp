@@ -0,0 +1,644 @@
+#include "matrixchaindistribute.h"
+#include <QCoreApplication>    // For the path of the executable started for the workers
+#include <QByteArray>          // For the worker arguments
+#include <QVector>             // For QVector
+#include <QtGlobal>            // For qWarning
+#include <algorithm>           // For std::max and std::sort
+#include <cmath>               // For std::sqrt
+#include <cstring>             // For std::strcmp
+#ifdef Q_OS_UNIX
+#include <cerrno>              // For checking EINTR
+#include <fcntl.h>             // For the close on exec flag
+#include <sys/socket.h>        // For the Unix domain sockets
+#include <sys/stat.h>          // For checking that an inherited descriptor is a socket
+#include <sys/wait.h>          // For waiting on the worker processes
+#include <unistd.h>            // For fork, execv, close and _exit
+#endif
+
+// Message types sent from the master to the workers
+static const int MSG_CHAIN = 1;         // Compute the product of a whole subchain
+static const int MSG_TILE_BEGIN = 2;    // Start a tile of the given size filled with zeros
+static const int MSG_PANEL_LEFT = 3;    // Panel of the left matrix for the rows of the tile
+static const int MSG_PANEL_RIGHT = 4;   // Panel of the right matrix for the columns of the tile, added to the tile
+static const int MSG_TILE_END = 5;      // Send the accumulated tile back
+static const int MSG_STOP = 6;          // Exit the worker loop
+
+const char *MatrixChainDistribute::WORKER_ARGUMENT = "--matrix-worker";
+
+// This function takes two flat row major matrices, their dimensions and a flat result matrix.
+// It adds the product of the two matrices to the result, so it can be used to accumulate the panels of a tile.
+static void multiplyAdd(const int *left, const int *right, int rows, int shared, int cols, int *result) {
+    for (int r = 0; r < rows; ++r) {
+        for (int k = 0; k < shared; ++k) {
+            int leftVal = left[r * shared + k];
+            for (int c = 0; c < cols; ++c) {
+                result[r * cols + c] += leftVal * right[k * cols + c];
+            }
+        }
+    }
+}
+
+#ifdef Q_OS_UNIX
+// Constructor to take ownership of an already connected socket file descriptor
+UnixSocketTransport::UnixSocketTransport(int fd) : socketFd(fd) {}
+
+// Close the socket when the transport is destroyed
+UnixSocketTransport::~UnixSocketTransport() {
+    if (socketFd >= 0) {
+        ::close(socketFd);
+    }
+}
+
+// This function sends one message as its length followed by all of its values.
+// It returns false if the other end is gone.
+bool UnixSocketTransport::sendMessage(const QVector<int> &message) {
+    int length = message.size();
+    if (!writeAll(&length, sizeof(length))) return false;
+    return length == 0 || writeAll(message.data(), sizeof(int) * length);
+}
+
+// This function reads the length of the next message and then all of its values into the passed vector.
+// It returns false if the other end is gone.
+bool UnixSocketTransport::receiveMessage(QVector<int> &message) {
+    int length = 0;
+    if (!readAll(&length, sizeof(length)) || length < 0) return false;
+    message.resize(length);
+    return length == 0 || readAll(message.data(), sizeof(int) * length);
+}
+
+// Returns the endpoint of this end, the socket is inherited by the worker process under the same descriptor number
+QByteArray UnixSocketTransport::endpoint() const {
+    return "unix:" + QByteArray::number(socketFd);
+}
+
+// Clear the close on exec flag, so the worker process started by the exec keeps this end
+void UnixSocketTransport::keepAcrossExec() {
+    ::fcntl(socketFd, F_SETFD, 0);
+}
+
+// Write the whole buffer to the socket, retrying on partial writes and interrupts
+bool UnixSocketTransport::writeAll(const void *buffer, size_t size) {
+    const char *data = static_cast<const char *>(buffer);
+    while (size > 0) {
+        ssize_t written = ::send(socketFd, data, size, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+// Read exactly size bytes from the socket, retrying on partial reads and interrupts
+bool UnixSocketTransport::readAll(void *buffer, size_t size) {
+    char *data = static_cast<char *>(buffer);
+    while (size > 0) {
+        ssize_t received = ::recv(socketFd, data, size, 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        data += received;
+        size -= received;
+    }
+    return true;
+}
+
+// Create a connected socket pair and wrap each end in its own transport.
+// Both ends are closed on exec, the worker process only keeps the end it is handed.
+bool UnixSocketTransport::createPair(std::unique_ptr<MatrixTransport> &masterEnd, std::unique_ptr<MatrixTransport> &workerEnd) {
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+        return false;
+    }
+    masterEnd.reset(new UnixSocketTransport(fds[0]));
+    workerEnd.reset(new UnixSocketTransport(fds[1]));
+    return true;
+}
+
+// This function takes the address part of a "unix" endpoint, which is the number of the inherited descriptor.
+// It returns the transport owning that descriptor, or nullptr if the address isn't a number or isn't an open socket.
+std::unique_ptr<MatrixTransport> UnixSocketTransport::open(const QByteArray &address) {
+    bool isNumber = false;
+    int fd = address.toInt(&isNumber);
+    struct stat status;
+    if (!isNumber || fd < 0 || ::fstat(fd, &status) != 0 || !S_ISSOCK(status.st_mode)) {
+        return nullptr;
+    }
+    return std::unique_ptr<MatrixTransport>(new UnixSocketTransport(fd));
+}
+#endif // Q_OS_UNIX
+
+// Constructor to set the MatrixChainSolve object and the number of worker processes
+// The tuning parameters get defaults that can be changed with the setters
+MatrixChainDistribute::MatrixChainDistribute(MatrixChainSolve *solve, int numWorkers)
+    : matrixSolve(solve), numWorkers(numWorkers), commWeight(4), tileThreshold(1 << 21), panelWidth(64),
+      numSubtrees(0), numTiles(0) {
+#ifdef Q_OS_UNIX
+    transportFactory = &UnixSocketTransport::createPair;
+#endif
+}
+
+// This function accepts no parameters. It calculates the optimal order, maps subtrees of it to the workers,
+// combines their results and returns the final matrix result.
+// In case the workers can't be used it falls back to MatrixChainSolve::solveMatrices and sets the last error.
+QVector<QVector<int>> MatrixChainDistribute::solveMatrices() {
+    lastError.clear();
+    numSubtrees = 0;
+    numTiles = 0;
+    int size = matrixSolve->getAllMatrices().size();
+    if (size == 0) return QVector<QVector<int>>();
+
+    matrixSolve->optimalOrderCost(); // Calculate the optimal order and cost tables
+    if (numWorkers < 1 || size == 1 || !isAvailable()) {
+        return matrixSolve->solveMatrices();
+    }
+
+    // A single subtree would only send the whole chain to one worker and back, so it is solved locally
+    QVector<ChainTask> tasks = planSubtrees();
+    if (tasks.size() == 1) {
+        return matrixSolve->solveMatrices();
+    }
+    assignWorkers(tasks);
+
+    subResults.clear();
+    subDims.clear();
+    subResults.resize(size * size);
+    subDims.resize(size * size);
+
+    if (!startWorkers()) {
+        lastError = "Couldn't start the worker processes, the matrices were solved locally.";
+        return matrixSolve->solveMatrices();
+    }
+
+    QVector<int> result;
+    int numRows = 0, numCols = 0;
+    bool isOk = runChainTasks(tasks) && combine(0, size - 1, result, numRows, numCols);
+    stopWorkers();
+
+    subResults.clear();
+    subDims.clear();
+    if (!isOk) {
+        lastError = "A worker process failed, the matrices were solved locally.";
+        numSubtrees = 0;
+        numTiles = 0;
+        return matrixSolve->solveMatrices();
+    }
+
+    // Reconstruct the final matrix from the flat format
+    QVector<QVector<int>> matrRes(numRows, QVector<int>(numCols));
+    for (int r = 0; r < numRows; ++r) {
+        for (int c = 0; c < numCols; ++c) {
+            matrRes[r][c] = result[r * numCols + c];
+        }
+    }
+    return matrRes;
+}
+
+// Returns true if worker processes can be started, which needs fork and exec
+bool MatrixChainDistribute::isAvailable() {
+#ifdef Q_OS_UNIX
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Create the needed setters
+void MatrixChainDistribute::setNumWorkers(int workers) {
+    numWorkers = workers;
+}
+void MatrixChainDistribute::setWorkerProgram(const QString &program) {
+    workerProgram = program;
+}
+void MatrixChainDistribute::setTransportFactory(const TransportFactory &factory) {
+    transportFactory = factory;
+}
+void MatrixChainDistribute::setCommWeight(int weight) {
+    commWeight = weight;
+}
+void MatrixChainDistribute::setTileThreshold(long long threshold) {
+    tileThreshold = threshold;
+}
+void MatrixChainDistribute::setPanelWidth(int width) {
+    panelWidth = qMax(1, width);
+}
+
+// Create the needed getters
+const QString& MatrixChainDistribute::getLastError() const {
+    return lastError;
+}
+int MatrixChainDistribute::getNumSubtrees() const {
+    return numSubtrees;
+}
+int MatrixChainDistribute::getNumTiles() const {
+    return numTiles;
+}
+
+// This function cuts the order tree into at most numWorkers subtrees. It starts from the whole chain and keeps splitting
+// the most expensive subtree at its optimal split point, as long as the time won by running the two halves in parallel
+// is bigger than the cost of sending the two intermediate results back to the master.
+// The product of the two halves is then computed above the subtrees, tiled over all workers if it reaches the tile
+// threshold and by the master alone otherwise.
+// It returns the list of subtrees, each subtree is later computed completely by one worker.
+QVector<MatrixChainDistribute::ChainTask> MatrixChainDistribute::planSubtrees() {
+    const QVector<int> &dims = matrixSolve->getMatrRowsCols();
+    const QVector<QVector<int>> &cost = matrixSolve->getCostMatr();
+    const QVector<QVector<int>> &order = matrixSolve->getOrderMatr();
+
+    QVector<ChainTask> tasks;
+    tasks.append({0, int(cost.size()) - 1, -1});
+
+    while (tasks.size() < numWorkers) {
+        // Find the most expensive subtree that can still be split
+        int best = -1;
+        for (int t = 0; t < tasks.size(); ++t) {
+            if (tasks[t].first < tasks[t].last &&
+                (best < 0 || cost[tasks[t].first][tasks[t].last] > cost[tasks[best].first][tasks[best].last])) {
+                best = t;
+            }
+        }
+        if (best < 0) break;
+
+        int i = tasks[best].first;
+        int j = tasks[best].last;
+        int k = order[i][j];
+        long long combineCost = (long long)dims[i] * dims[k + 1] * dims[j + 1];
+        long long combineTime = combineCost >= tileThreshold ? combineCost / numWorkers : combineCost;
+        long long gain = cost[i][j] - qMax(cost[i][k], cost[k + 1][j]) - combineTime;
+        long long extraComm = (long long)dims[i] * dims[k + 1] + (long long)dims[k + 1] * dims[j + 1];
+
+        // Stop splitting once moving the intermediate results costs more than the parallel work saves
+        if (gain <= commWeight * extraComm) break;
+
+        tasks[best] = {i, k, -1};
+        tasks.append({k + 1, j, -1});
+    }
+    return tasks;
+}
+
+// This function takes the planned subtrees and maps each of them to a worker.
+// The subtrees are placed from the heaviest to the lightest on the least loaded worker, where the load of a subtree
+// is its multiplication cost plus the weighted number of elements that have to be sent to and from the worker.
+// All operands come from the master and all results go back to it, so the elements moved are the same on every
+// worker and only the balance of the loads decides the mapping.
+// Single matrices don't need any work, they are kept on the master.
+void MatrixChainDistribute::assignWorkers(QVector<ChainTask> &tasks) {
+    const QVector<QVector<int>> &cost = matrixSolve->getCostMatr();
+
+    QVector<int> sorted(tasks.size());
+    QVector<long long> weight(tasks.size());
+    for (int t = 0; t < tasks.size(); ++t) {
+        sorted[t] = t;
+        weight[t] = cost[tasks[t].first][tasks[t].last] + commWeight * commVolume(tasks[t].first, tasks[t].last);
+    }
+    std::sort(sorted.begin(), sorted.end(), [&weight](int a, int b) { return weight[a] > weight[b]; });
+
+    QVector<long long> load(numWorkers, 0);
+    for (int t : sorted) {
+        if (tasks[t].first == tasks[t].last) {
+            tasks[t].worker = -1;
+            continue;
+        }
+        int worker = std::min_element(load.begin(), load.end()) - load.begin();
+        tasks[t].worker = worker;
+        load[worker] += weight[t];
+    }
+}
+
+// Returns the number of elements that are moved when the subchain i to j is computed on a worker:
+// all of its input matrices sent by the master plus the result sent back
+long long MatrixChainDistribute::commVolume(int i, int j) const {
+    const QVector<int> &dims = matrixSolve->getMatrRowsCols();
+    long long volume = (long long)dims[i] * dims[j + 1];
+    for (int m = i; m <= j; ++m) {
+        volume += (long long)dims[m] * dims[m + 1];
+    }
+    return volume;
+}
+
+// This function spawns numWorkers processes, each connected to the master with its own transport.
+// Every worker executes the program again with the worker argument and the endpoint of its transport end, so no Qt
+// or allocator state of this process is used after the fork. The transport factory creates the master ends closed
+// on exec, which keeps a worker from holding the connections of the other workers open.
+// It returns false if a transport or a process couldn't be created.
+bool MatrixChainDistribute::startWorkers() {
+#ifdef Q_OS_UNIX
+    QByteArray program = (workerProgram.isEmpty() ? QCoreApplication::applicationFilePath() : workerProgram).toLocal8Bit();
+    QByteArray argument(WORKER_ARGUMENT);
+
+    for (int w = 0; w < numWorkers; ++w) {
+        std::unique_ptr<MatrixTransport> masterEnd, workerEnd;
+        if (!transportFactory(masterEnd, workerEnd)) {
+            stopWorkers();
+            return false;
+        }
+
+        // Prepare the arguments before the fork, the child only calls async signal safe functions
+        QByteArray endpointArgument = workerEnd->endpoint();
+        char *args[] = {program.data(), argument.data(), endpointArgument.data(), nullptr};
+
+        pid_t pid = ::fork();
+        if (pid < 0) {
+            stopWorkers();
+            return false;
+        }
+        if (pid == 0) {
+            // Inside the worker process, keep only the worker end across the exec
+            workerEnd->keepAcrossExec();
+            ::execv(args[0], args);
+            ::_exit(127);
+        }
+
+        workers.push_back({pid, std::move(masterEnd)});
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Send the stop message to every worker and wait for the processes to exit
+void MatrixChainDistribute::stopWorkers() {
+    for (Worker &worker : workers) {
+        worker.transport->sendMessage(QVector<int>{MSG_STOP});
+        worker.transport.reset();
+#ifdef Q_OS_UNIX
+        ::waitpid(pid_t(worker.pid), nullptr, 0);
+#endif
+    }
+    workers.clear();
+}
+
+// This function sends each subtree together with its operands to the worker it was mapped to and stores the results.
+// The work is done in rounds with at most one outstanding task per worker, so the master never blocks on writing to
+// a worker that is itself blocked on writing a result back.
+// It returns false if a worker failed.
+bool MatrixChainDistribute::runChainTasks(const QVector<ChainTask> &tasks) {
+    const QVector<QVector<int>> &allMatrices = matrixSolve->getAllMatrices();
+    const QVector<int> &dims = matrixSolve->getMatrRowsCols();
+    int size = allMatrices.size();
+
+    // Queue the subtrees for each worker
+    QVector<QVector<int>> queues(workers.size());
+    for (int t = 0; t < tasks.size(); ++t) {
+        if (tasks[t].worker >= 0) {
+            queues[tasks[t].worker].append(t);
+        }
+    }
+
+    for (int round = 0; ; ++round) {
+        QVector<int> sent(workers.size(), -1);
+        bool isAnySent = false;
+
+        for (int w = 0; w < int(workers.size()); ++w) {
+            if (round >= queues[w].size()) continue;
+            const ChainTask &task = tasks[queues[w][round]];
+
+            // Build the message: type, number of matrices, their dimensions and all of their values
+            QVector<int> message{MSG_CHAIN, task.last - task.first + 1};
+            for (int m = task.first; m <= task.last + 1; ++m) {
+                message.append(dims[m]);
+            }
+            for (int m = task.first; m <= task.last; ++m) {
+                message.append(allMatrices[m]);
+            }
+
+            if (!workers[w].transport->sendMessage(message)) return false;
+            sent[w] = queues[w][round];
+            isAnySent = true;
+        }
+        if (!isAnySent) break;
+
+        for (int w = 0; w < int(workers.size()); ++w) {
+            if (sent[w] < 0) continue;
+            const ChainTask &task = tasks[sent[w]];
+
+            QVector<int> reply;
+            if (!workers[w].transport->receiveMessage(reply) || reply.size() < 2 ||
+                reply.size() != 2 + reply[0] * reply[1]) return false;
+
+            int index = task.first * size + task.last;
+            subDims[index] = QVector<int>{reply[0], reply[1]};
+            subResults[index] = reply.mid(2);
+            ++numSubtrees;
+        }
+    }
+    return true;
+}
+
+// This function recursively evaluates the part of the order tree above the subtrees computed by the workers.
+// It takes the range i to j and returns the flat result with its number of rows and columns through the references.
+// Large products are split into tiles and computed by the workers, smaller ones are computed on the master.
+bool MatrixChainDistribute::combine(int i, int j, QVector<int> &result, int &rows, int &cols) {
+    const QVector<int> &dims = matrixSolve->getMatrRowsCols();
+    int size = matrixSolve->getAllMatrices().size();
+    int index = i * size + j;
+
+    // The subchain was already computed by a worker
+    if (!subDims[index].isEmpty()) {
+        rows = subDims[index][0];
+        cols = subDims[index][1];
+        result = subResults[index];
+        return true;
+    }
+    // A single matrix is already stored in the flat format
+    if (i == j) {
+        rows = dims[i];
+        cols = dims[i + 1];
+        result = matrixSolve->getAllMatrices()[i];
+        return true;
+    }
+
+    int k = matrixSolve->getOrderMatr()[i][j];
+    QVector<int> leftMatr, rightMatr;
+    int shared = 0;
+    if (!combine(i, k, leftMatr, rows, shared) || !combine(k + 1, j, rightMatr, shared, cols)) {
+        return false;
+    }
+
+    if ((long long)rows * shared * cols >= tileThreshold) {
+        return multiplyTiled(leftMatr, rightMatr, rows, shared, cols, result);
+    }
+    result = QVector<int>(rows * cols, 0);
+    multiplyAdd(leftMatr.data(), rightMatr.data(), rows, shared, cols, result.data());
+    return true;
+}
+
+// This function computes a large product SUMMA style. The result is split into a 2D grid of tiles and every worker
+// of a round starts one tile. The shared dimension is then streamed one panel at a time: the panel of the left matrix
+// for each grid row and of the right matrix for each grid column is packed once and sent to every tile of that
+// row/column, and the workers add each panel product (a rank-k update) to their tile while the next panel is packed.
+// It returns false if a worker failed.
+bool MatrixChainDistribute::multiplyTiled(const QVector<int> &left, const QVector<int> &right,
+                                          int rows, int shared, int cols, QVector<int> &result) {
+    int grid = int(std::ceil(std::sqrt(double(workers.size()))));
+    int gridRows = std::min(grid, rows);
+    int gridCols = std::min(grid, cols);
+    int numGridTiles = gridRows * gridCols;
+    result = QVector<int>(rows * cols, 0);
+
+    // Row and column ranges of the tiles in the grid
+    auto rowStart = [&](int tile) { return (tile / gridCols) * rows / gridRows; };
+    auto rowEnd = [&](int tile) { return (tile / gridCols + 1) * rows / gridRows; };
+    auto colStart = [&](int tile) { return (tile % gridCols) * cols / gridCols; };
+    auto colEnd = [&](int tile) { return (tile % gridCols + 1) * cols / gridCols; };
+
+    for (int firstTile = 0; firstTile < numGridTiles; firstTile += workers.size()) {
+        int numSent = std::min(int(workers.size()), numGridTiles - firstTile);
+
+        // Start one tile on every worker of the round
+        for (int w = 0; w < numSent; ++w) {
+            int tile = firstTile + w;
+            QVector<int> message{MSG_TILE_BEGIN, rowEnd(tile) - rowStart(tile), colEnd(tile) - colStart(tile)};
+            if (!workers[w].transport->sendMessage(message)) return false;
+        }
+
+        // Stream the panels of the shared dimension
+        for (int kStart = 0; kStart < shared; kStart += panelWidth) {
+            int kEnd = std::min(shared, kStart + panelWidth);
+            QVector<QVector<int>> leftPanels(gridRows), rightPanels(gridCols);
+
+            for (int w = 0; w < numSent; ++w) {
+                int tile = firstTile + w;
+                QVector<int> &leftPanel = leftPanels[tile / gridCols];
+                QVector<int> &rightPanel = rightPanels[tile % gridCols];
+
+                // Pack the panels the first time a tile of their grid row/column needs them
+                if (leftPanel.isEmpty()) {
+                    leftPanel = QVector<int>{MSG_PANEL_LEFT, kEnd - kStart};
+                    for (int r = rowStart(tile); r < rowEnd(tile); ++r) {
+                        for (int k = kStart; k < kEnd; ++k) {
+                            leftPanel.append(left[r * shared + k]);
+                        }
+                    }
+                }
+                if (rightPanel.isEmpty()) {
+                    rightPanel = QVector<int>{MSG_PANEL_RIGHT, kEnd - kStart};
+                    for (int k = kStart; k < kEnd; ++k) {
+                        for (int c = colStart(tile); c < colEnd(tile); ++c) {
+                            rightPanel.append(right[k * cols + c]);
+                        }
+                    }
+                }
+
+                if (!workers[w].transport->sendMessage(leftPanel) || !workers[w].transport->sendMessage(rightPanel)) {
+                    return false;
+                }
+            }
+        }
+
+        // Ask every worker of the round for its tile, then collect them
+        for (int w = 0; w < numSent; ++w) {
+            if (!workers[w].transport->sendMessage(QVector<int>{MSG_TILE_END})) return false;
+        }
+        for (int w = 0; w < numSent; ++w) {
+            int tile = firstTile + w;
+            QVector<int> reply;
+            if (!workers[w].transport->receiveMessage(reply) || reply.size() < 2 ||
+                reply[0] != rowEnd(tile) - rowStart(tile) || reply[1] != colEnd(tile) - colStart(tile) ||
+                reply.size() != 2 + reply[0] * reply[1]) return false;
+
+            // Copy the tile into its place in the result
+            for (int r = 0; r < reply[0]; ++r) {
+                for (int c = 0; c < reply[1]; ++c) {
+                    result[(rowStart(tile) + r) * cols + colStart(tile) + c] = reply[2 + r * reply[1] + c];
+                }
+            }
+            ++numTiles;
+        }
+    }
+    return true;
+}
+
+// This function is the message loop of a worker process. It computes the subchains it receives and accumulates the
+// panel products of a tile, and sends back each result as its number of rows, columns and values.
+// It returns when the stop message is received, the master is gone or a message is malformed.
+void MatrixChainDistribute::runWorker(MatrixTransport &transport) {
+    QVector<int> message;
+    QVector<int> tile;          // Rows, columns and values of the tile being accumulated
+    QVector<int> leftPanel;     // Last received panel of the left matrix, with its header
+
+    while (transport.receiveMessage(message) && !message.isEmpty() && message[0] != MSG_STOP) {
+        if (message[0] == MSG_CHAIN) {
+            // Rebuild the subchain and solve it with the optimal order of its own
+            int count = message.size() > 1 ? message[1] : 0;
+            if (count < 1 || message.size() < 3 + count) return;
+            QVector<int> rowsCols = message.mid(2, count + 1);
+            QVector<QVector<int>> matrices;
+            int pos = 2 + count + 1;
+            for (int m = 0; m < count; ++m) {
+                int numValues = rowsCols[m] * rowsCols[m + 1];
+                matrices.append(message.mid(pos, numValues));
+                pos += numValues;
+            }
+            if (pos != message.size()) return;
+
+            MatrixChainSolve solve;
+            solve.setMatrRowsCols(rowsCols);
+            solve.setAllMatrices(matrices);
+            QVector<QVector<int>> matrRes = solve.solveMatrices();
+
+            QVector<int> reply{rowsCols[0], rowsCols[count]};
+            for (const QVector<int> &row : matrRes) {
+                reply.append(row);
+            }
+            if (!transport.sendMessage(reply)) return;
+        } else if (message[0] == MSG_TILE_BEGIN && message.size() == 3) {
+            // Start a new tile filled with zeros
+            tile = QVector<int>(2 + message[1] * message[2], 0);
+            tile[0] = message[1];
+            tile[1] = message[2];
+        } else if (message[0] == MSG_PANEL_LEFT && !tile.isEmpty() && message.size() == 2 + tile[0] * message[1]) {
+            leftPanel = message;
+        } else if (message[0] == MSG_PANEL_RIGHT && !leftPanel.isEmpty() && message[1] == leftPanel[1] &&
+                   message.size() == 2 + message[1] * tile[1]) {
+            // Rank-k update of the tile with the product of the two panels
+            multiplyAdd(leftPanel.data() + 2, message.data() + 2, tile[0], message[1], tile[1], tile.data() + 2);
+        } else if (message[0] == MSG_TILE_END && !tile.isEmpty()) {
+            if (!transport.sendMessage(tile)) return;
+            tile.clear();
+            leftPanel.clear();
+        } else {
+            return;
+        }
+    }
+}
+
+// Returns true if the executable was started as a worker process by startWorkers
+bool MatrixChainDistribute::isWorkerProcess(int argc, char *argv[]) {
+    return argc == 3 && std::strcmp(argv[1], WORKER_ARGUMENT) == 0;
+}
+
+// Entry point of a worker process. The second argument is the endpoint of its end of the transport, which is opened
+// with the worker transport registered for the scheme of the endpoint.
+// It returns the exit code of the process, 1 if the endpoint couldn't be opened.
+int MatrixChainDistribute::runWorkerProcess(char *argv[]) {
+    QByteArray endpoint(argv[2]);
+    int separator = endpoint.indexOf(':');
+    const QHash<QByteArray, WorkerTransportFactory> &transports = workerTransports();
+
+    std::unique_ptr<MatrixTransport> transport;
+    if (separator > 0 && transports.contains(endpoint.left(separator))) {
+        transport = transports.value(endpoint.left(separator))(endpoint.mid(separator + 1));
+    }
+    if (!transport) {
+        qWarning("Couldn't open the worker endpoint %s", argv[2]);
+        return 1;
+    }
+    runWorker(*transport);
+    return 0;
+}
+
+// Add or replace the worker side factory of a transport scheme
+void MatrixChainDistribute::registerWorkerTransport(const QByteArray &scheme, const WorkerTransportFactory &factory) {
+    workerTransports().insert(scheme, factory);
+}
+
+// Returns the worker side factories by scheme, starting with the Unix socket backend
+QHash<QByteArray, MatrixChainDistribute::WorkerTransportFactory> &MatrixChainDistribute::workerTransports() {
+#ifdef Q_OS_UNIX
+    static QHash<QByteArray, WorkerTransportFactory> transports{{"unix", &UnixSocketTransport::open}};
+#else
+    static QHash<QByteArray, WorkerTransportFactory> transports;
+#endif
+    return transports;
+}
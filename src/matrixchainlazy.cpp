@@ -0,0 +1,106 @@
+#include "matrixchainlazy.h"
+#include <QVector>             // For QVector
+
+// Constructor to set the passed parameter value to the MatrixChainSolve member variable of type pointer to object
+// It has one input parameter: MatrixChainSolve *solve a pointer to a MatrixChainSolve object
+MatrixChainLazy::MatrixChainLazy(MatrixChainSolve *solve) : matrixSolve(solve), lastCost(0) {}
+
+// This function takes a row index and returns that row of the result, or an empty vector if the index is out of range
+QVector<int> MatrixChainLazy::row(int r) {
+    QVector<QVector<int>> matrRes = block(r, 0, 1, getNumCols());
+    return matrRes.isEmpty() ? QVector<int>() : matrRes[0];
+}
+
+// This function takes a column index and returns that column of the result, or an empty vector if the index is out of range
+QVector<int> MatrixChainLazy::col(int c) {
+    QVector<QVector<int>> matrRes = block(0, c, getNumRows(), 1);
+    QVector<int> column;
+    for (const QVector<int> &matrRow : matrRes) {
+        column.append(matrRow[0]);
+    }
+    return column;
+}
+
+// This function takes the first row and column of a block and its height and width.
+// Only the rows r0 to r0+h-1 of the first matrix and the columns c0 to c0+w-1 of the last matrix take part in the block,
+// so the chain is narrowed to those, its optimal order is planned again for the new shape and only the block is computed.
+// It returns the block as a 2D QVector, or an empty QVector if the block doesn't fit in the result.
+QVector<QVector<int>> MatrixChainLazy::block(int r0, int c0, int h, int w) {
+    const QVector<QVector<int>> &allMatrices = matrixSolve->getAllMatrices();
+    const QVector<int> &matrRowsCols = matrixSolve->getMatrRowsCols();
+    int size = allMatrices.size();
+    if (size == 0 || r0 < 0 || c0 < 0 || h < 1 || w < 1 ||
+        r0 + h > matrRowsCols[0] || c0 + w > matrRowsCols[size]) {
+        return QVector<QVector<int>>();
+    }
+
+    QVector<QVector<int>> matrices = allMatrices;  // Only the first and last matrices are changed, the rest stay shared
+    QVector<int> rowsCols = matrRowsCols;
+
+    // Keep the rows r0 to r0+h-1 of the first matrix, they are stored next to each other in the 1D format
+    matrices[0] = allMatrices[0].mid(r0 * rowsCols[1], h * rowsCols[1]);
+    rowsCols[0] = h;
+
+    // Keep the columns c0 to c0+w-1 of the last matrix
+    int numRows = rowsCols[size - 1];
+    int numCols = rowsCols[size];
+    QVector<int> lastMatr(numRows * w);
+    for (int r = 0; r < numRows; ++r) {
+        for (int c = 0; c < w; ++c) {
+            lastMatr[r * w + c] = matrices[size - 1][r * numCols + c0 + c];
+        }
+    }
+    matrices[size - 1] = lastMatr;
+    rowsCols[size] = w;
+
+    return solveChain(matrices, rowsCols);
+}
+
+// This function takes a vector with as many values as the result has columns and returns the result multiplied with it.
+// The vector is added to the end of the chain as a matrix with one column, so the planned order multiplies it in early
+// and the chain is computed with matrix-vector products instead of full matrix products.
+// It returns an empty vector if the vector has the wrong size.
+QVector<int> MatrixChainLazy::apply(const QVector<int> &vect) {
+    const QVector<QVector<int>> &allMatrices = matrixSolve->getAllMatrices();
+    const QVector<int> &matrRowsCols = matrixSolve->getMatrRowsCols();
+    if (allMatrices.isEmpty() || vect.size() != matrRowsCols.last()) {
+        return QVector<int>();
+    }
+
+    QVector<QVector<int>> matrices = allMatrices;
+    QVector<int> rowsCols = matrRowsCols;
+    matrices.append(vect);
+    rowsCols.append(1);
+
+    QVector<int> res;
+    for (const QVector<int> &matrRow : solveChain(matrices, rowsCols)) {
+        res.append(matrRow[0]);
+    }
+    return res;
+}
+
+// Create the needed getters
+int MatrixChainLazy::getNumRows() const {
+    const QVector<int> &matrRowsCols = matrixSolve->getMatrRowsCols();
+    return matrRowsCols.isEmpty() ? 0 : matrRowsCols.first();
+}
+int MatrixChainLazy::getNumCols() const {
+    const QVector<int> &matrRowsCols = matrixSolve->getMatrRowsCols();
+    return matrRowsCols.isEmpty() ? 0 : matrRowsCols.last();
+}
+int MatrixChainLazy::getLastCost() const {
+    return lastCost;
+}
+
+// This function takes a modified chain and its rows/columns vector. It plans the optimal order for the new shape with
+// optimalOrderCost, computes the product and keeps the planned minimal cost.
+// It returns the product of the modified chain.
+QVector<QVector<int>> MatrixChainLazy::solveChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols) {
+    MatrixChainSolve solve;
+    solve.setAllMatrices(matrices);
+    solve.setMatrRowsCols(rowsCols);
+    QVector<QVector<int>> matrRes = solve.solveMatrices();  // Calls optimalOrderCost over the modified shape vector
+
+    lastCost = solve.getCostMatr()[0][matrices.size() - 1];
+    return matrRes;
+}
@@ -1,4 +1,4 @@
-#include "MatrixChainSolve.h"
+#include "matrixchainsolve.h"
 #include <QMessageBox>         // For displaying warnings
 #include <QRegularExpression>  // To match strings
 #include <QString>             // For QString
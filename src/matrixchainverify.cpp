@@ -0,0 +1,152 @@
+#include "matrixchainverify.h"
+#include <QRandomGenerator>    // For the random vectors
+#include <QVector>             // For QVector
+#include <cmath>               // For std::log, std::ceil and std::fabs
+
+// Mersenne prime 2^31 - 1, so the product of two reduced values fits in 64 bits
+const quint64 MatrixChainVerify::MODULUS = 2147483647ULL;
+
+// This function takes the chain, its rows/columns vector and a vector with as many values as the last matrix has columns.
+// It multiplies the vector through the chain from right to left, so only matrix-vector products are needed.
+// The convert function turns a matrix entry into type T and reduce is applied after every multiply-add.
+template <typename T, typename Convert, typename Reduce>
+static QVector<T> chainTimesVector(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                                   QVector<T> vect, Convert convert, Reduce reduce) {
+    for (int m = allMatrices.size() - 1; m >= 0; --m) {
+        int numRows = matrRowsCols[m];
+        int numCols = matrRowsCols[m + 1];
+        QVector<T> next(numRows, T(0));
+        for (int r = 0; r < numRows; ++r) {
+            for (int c = 0; c < numCols; ++c) {
+                next[r] = reduce(next[r] + reduce(convert(allMatrices[m][r * numCols + c]) * vect[c]));
+            }
+        }
+        vect = next;
+    }
+    return vect;
+}
+
+// This function multiplies the 2D result with the vector using the same convert and reduce functions
+template <typename T, typename Convert, typename Reduce>
+static QVector<T> resultTimesVector(const QVector<QVector<int>> &result, const QVector<T> &vect, Convert convert, Reduce reduce) {
+    QVector<T> res(result.size(), T(0));
+    for (int r = 0; r < result.size(); ++r) {
+        for (int c = 0; c < result[r].size(); ++c) {
+            res[r] = reduce(res[r] + reduce(convert(result[r][c]) * vect[c]));
+        }
+    }
+    return res;
+}
+
+// Constructor to set the comparison mode and the accepted false positive probability
+MatrixChainVerify::MatrixChainVerify(Mode mode, double bound)
+    : verifyMode(mode), falsePositiveBound(bound), tolerance(1e-9) {}
+
+// This function takes the chain, its rows/columns vector and the computed result.
+// It checks the dimensions of the result and then runs the check of the chosen mode.
+// It returns true if the result passed, a wrong result passes with at most the false positive bound probability.
+bool MatrixChainVerify::verify(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                               const QVector<QVector<int>> &result) const {
+    if (allMatrices.isEmpty() || matrRowsCols.size() != allMatrices.size() + 1) return false;
+
+    // The result must have the rows of the first matrix and the columns of the last one
+    if (result.size() != matrRowsCols.first()) return false;
+    for (const QVector<int> &row : result) {
+        if (row.size() != matrRowsCols.last()) return false;
+    }
+
+    switch (verifyMode) {
+    case Modular:
+        return verifyModular(allMatrices, matrRowsCols, result);
+    case Tolerance:
+        return verifyTolerance(allMatrices, matrRowsCols, result);
+    default:
+        return verifyExact(allMatrices, matrRowsCols, result);
+    }
+}
+
+// Create the needed setters
+void MatrixChainVerify::setMode(Mode mode) {
+    verifyMode = mode;
+}
+void MatrixChainVerify::setFalsePositiveBound(double bound) {
+    falsePositiveBound = bound;
+}
+void MatrixChainVerify::setTolerance(double tol) {
+    tolerance = tol;
+}
+
+// Create the needed getters
+MatrixChainVerify::Mode MatrixChainVerify::getMode() const {
+    return verifyMode;
+}
+
+// Every random vector lets a wrong result pass with at most 1/2 probability, or 1/MODULUS in modular mode,
+// so the number of vectors is the smallest k for which that probability to the power k is below the bound
+int MatrixChainVerify::getNumTrials() const {
+    if (falsePositiveBound <= 0.0 || falsePositiveBound >= 1.0) return 1;
+    double perTrial = verifyMode == Modular ? 1.0 / MODULUS : 0.5;
+    return qMax(1, int(std::ceil(std::log(falsePositiveBound) / std::log(perTrial))));
+}
+
+// Compare the two sides in unsigned 32 bit arithmetic, which wraps around exactly like the int result of the multiplication
+bool MatrixChainVerify::verifyExact(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                                    const QVector<QVector<int>> &result) const {
+    auto convert = [](int val) { return quint32(val); };
+    auto reduce = [](quint32 val) { return val; };
+
+    for (int trial = getNumTrials(); trial > 0; --trial) {
+        QVector<quint32> vect(matrRowsCols.last());
+        for (quint32 &val : vect) {
+            val = QRandomGenerator::global()->generate();
+        }
+        if (chainTimesVector(allMatrices, matrRowsCols, vect, convert, reduce) != resultTimesVector(result, vect, convert, reduce)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compare the two sides modulo a prime. A result whose int values overflowed doesn't match the true product and fails
+bool MatrixChainVerify::verifyModular(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                                      const QVector<QVector<int>> &result) const {
+    auto convert = [](int val) { return quint64((qint64(val) % qint64(MODULUS) + qint64(MODULUS)) % qint64(MODULUS)); };
+    auto reduce = [](quint64 val) { return val % MODULUS; };
+
+    for (int trial = getNumTrials(); trial > 0; --trial) {
+        QVector<quint64> vect(matrRowsCols.last());
+        for (quint64 &val : vect) {
+            val = QRandomGenerator::global()->bounded(quint32(MODULUS));
+        }
+        if (chainTimesVector(allMatrices, matrRowsCols, vect, convert, reduce) != resultTimesVector(result, vect, convert, reduce)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compare the two sides in floating point. Each entry may differ by the tolerance times the same product
+// computed with absolute values, which bounds the rounding error of the entry
+bool MatrixChainVerify::verifyTolerance(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                                        const QVector<QVector<int>> &result) const {
+    auto convert = [](int val) { return double(val); };
+    auto convertAbs = [](int val) { return std::fabs(double(val)); };
+    auto reduce = [](double val) { return val; };
+
+    for (int trial = getNumTrials(); trial > 0; --trial) {
+        QVector<double> vect(matrRowsCols.last());
+        for (double &val : vect) {
+            val = QRandomGenerator::global()->generateDouble();
+        }
+        QVector<double> expected = chainTimesVector(allMatrices, matrRowsCols, vect, convert, reduce);
+        QVector<double> scale = chainTimesVector(allMatrices, matrRowsCols, vect, convertAbs, reduce);
+        QVector<double> actual = resultTimesVector(result, vect, convert, reduce);
+
+        for (int r = 0; r < actual.size(); ++r) {
+            if (std::fabs(actual[r] - expected[r]) > tolerance * qMax(1.0, scale[r])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
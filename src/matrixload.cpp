@@ -2,23 +2,28 @@
 #include <QFileDialog>             // For file dialog handling
 #include <QTextStream>             // For file reading/writing in file streams
 #include <QMessageBox>             // For displaying Q message boxes
-#include <QDir>                    // For creating opening directories
-#include <QRegularExpression>      // To match strings
 #include <QInputDialog>            // To get the input of the user
+#include <QFileInfo>               // To compare file paths
+#include <climits>                 // For INT_MAX use
 
-// Hold the names of the matrix file and folder used for the file path
+// Hold the name of the folder used for the chain store
 const QString MatrixLoad::MATRIX_FOLDER_NAME = "Matrices";
-const QString MatrixLoad::MATRIX_FILE_NAME = "saved_matrices";
 
 // Constructor to set the passed parameter value to the MatrixChainSolve member variable of type pointer to object
 // It has one input parameter: MatrixChainSolve *solve a pointer to a MatrixChainSolve object
-MatrixLoad::MatrixLoad(MatrixChainSolve *solve) : matrixSolve(solve) {}
+MatrixLoad::MatrixLoad(MatrixChainSolve *solve) : matrixStore(MATRIX_FOLDER_NAME), matrixSolve(solve) {}
 
 // Open a .txt file and set the matrices and rows/columns to the allMatrices and matrRowsCols member variables of type vector
 // It has one parameter: const QString &filename that contains the directory of the file that was chosen from the user
 // It is declared as constant to prevent ac
 // The function is void so it has no return value, its purpose is to fill the two vectors with the data from the passed .txt file
+// In case the index file of the chain store was chosen, a saved chain is loaded from the store instead
 void MatrixLoad::loadMatrices(const QString &filename) {
+    if (!filename.isEmpty() && QFileInfo(filename) == QFileInfo(matrixStore.getIndexPath())) {
+        loadFromStore();
+        return;
+    }
+
     QFile file(filename); // Create a file object to hold the file in
     // Try to open the file in read mode print warning message and return in case we weren't able to open the file
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
@@ -84,76 +89,44 @@ void MatrixLoad::loadMatrices(const QString &filename) {
     }
 }
 
-// Method that saves the matrices from the allMatrices and matrRowsCols vectors to files matrices to files
+// Method that saves the matrices from the allMatrices and matrRowsCols vectors to the chain store
 // The function is void so it has no return value and it has no input parameters
-// Its purpose is to Iterate through information from member variables of type vector and set it to .txt files
+// Matrices that are already stored are not written again, and a chain that is already stored is not saved again
 void MatrixLoad::saveMatricesToFile() {
     const QVector<QVector<int>>& allMatrices = matrixSolve->getAllMatrices();
     const QVector<int>& matrRowsCols = matrixSolve->getMatrRowsCols();
 
-    // Check if the folder exists and if it doesnt create it
-    QDir dir;
-    if (!dir.exists(MATRIX_FOLDER_NAME)) {
-        dir.mkdir(MATRIX_FOLDER_NAME);
-    }
-
-    int nextID = getFileID(); // Find the last ID + 1 of all saved files and return it
-
-    // Create the file path
-    QString filePath = MATRIX_FOLDER_NAME + "/" + MATRIX_FILE_NAME + "_" + QString::number(nextID) + ".txt";
-    QFile outFile(filePath); // Create a file object of the file path
-
-    if (outFile.open(QIODevice::WriteOnly | QIODevice::Text)) {  // Open the file to write in it
-        QTextStream out(&outFile);  // Open the file output stream
-
-        // Iterate through the matrices to save them in the new file
-        for (int i = 0; i < allMatrices.size(); ++i) {
-            int numRows = matrRowsCols[i];       // Get the number of rows of the current matrix
-            int numCols = matrRowsCols[i + 1];   // Get the number of columns of the current matrix
-            out << numRows << " " << numCols << "\n";  // Write the number of matrix rows and columns in the file
-
-            const QVector<int> &matr = allMatrices[i];  // Get the matrix data of current matrix
-            for (int val : matr) {
-                out << val << " ";  // Write the values of the matrix
-            }
-            out << "\n"; // End the line after each matrix
-        }
-
-        outFile.close();  // Close the file
-
-        // Add each saved file path to the saved files vector, to delete later if cancel button was clicked
-        savedFiles.append(filePath);
-    } else {
+    bool isNewChain;
+    int savedID = matrixStore.saveChain(allMatrices, matrRowsCols, isNewChain);
+    if (savedID < 0) {
         QMessageBox::warning(nullptr, "Error", "Couldn't save the matrices to a file.");
+    } else if (!isNewChain) {
+        QMessageBox::information(nullptr, "Save Matrices", QString("These matrices are already saved with id: %1.").arg(savedID));
+    } else {
+        QMessageBox::information(nullptr, "Save Matrices", QString("The matrices were saved with id: %1.").arg(savedID));
     }
 }
-// Getter to access savedFiles getter outside of this class
-const QVector<QString>& MatrixLoad::getSavedFiles() const {
-    return savedFiles;
+// Getter to access the chain store outside of this class
+MatrixStore& MatrixLoad::getStore() {
+    return matrixStore;
 }
-// Get the current file ID by accessing all files to a given directory and finding the highest ID of the .txt files with a given name in the directory
-// This function has no input parameters
-// The function has a return type integer that returns the value of the found highest ID +1 to use it when creating the next file
-int MatrixLoad::getFileID() {
-    QDir dir(MatrixLoad::MATRIX_FOLDER_NAME);  // Get the name of the folder that is used
-    QFileInfoList files = dir.entryInfoList(QDir::Files);  // Get all the files in the folder
-
-    int maxFileID = 0;
-    // Match the file names to the given string
-    QRegularExpression regex("saved_matrices_(\\d+)\\.txt");
-
-    // Loop through all files in the folder to find the highest file ID
-    for (int i = 0; i < files.size(); ++i) { // Iterate until all files
-        const QFileInfo &fileInfo = files.at(i); // Reference the copy of the current file
-        QString fileName = fileInfo.fileName(); // Get the name of the file only
-        QRegularExpressionMatch match = regex.match(fileName); // try to match the current file to: "saved_matrices_(\\d+)\\.txt"
-
-        // If the file name of the current file was matched
-        if (match.hasMatch()) {
-            int lastID = match.captured(1).toInt(); // Get the captured value and turn it to int
-            maxFileID = qMax(maxFileID, lastID); // Get the highest found id between the lastID maxFileID
-        }
+// Ask the user for the id of a saved chain and load it from the chain store into the allMatrices and matrRowsCols vectors
+// The function is void so it has no return value and it has no input parameters
+void MatrixLoad::loadFromStore() {
+    bool isOk;
+    int chainID = QInputDialog::getInt(nullptr, "Load Matrices", "Enter the id of the saved matrices:", 1, 1, INT_MAX, 1, &isOk);
+    if (!isOk) return;
+
+    QVector<QVector<int>> allMatrTemp;  // Temporary vector to hold all matrices in
+    QVector<int> rowsColsTemp;          // Temporary vector to hold rows and cols in
+    if (!matrixStore.loadChain(chainID, allMatrTemp, rowsColsTemp)) {
+        QMessageBox::warning(nullptr, "File open Error", QString("The matrices with id: %1 couldn't be loaded.").arg(chainID));
+        return;
     }
 
-    return maxFileID + 1;  // Return the highest found ID + 1 to create the new avaiable ID
+    // Clear any previous saved data in the memory and set the loaded chain
+    matrixSolve->clearMatrData();
+    matrixSolve->clearCostOrder();
+    matrixSolve->setMatrRowsCols(rowsColsTemp);
+    matrixSolve->setAllMatrices(allMatrTemp);
 }
@@ -0,0 +1,376 @@
+#include "matrixstore.h"
+#include <QCryptographicHash>      // For the content hashes
+#include <QByteArray>              // For the raw file contents
+#include <QSaveFile>               // For writing the objects atomically
+#include <QLockFile>               // For locking the index against other running programs
+#include <QTextStream>             // For reading the object values
+#include <QSet>                    // For the set of referenced objects
+#include <QFile>                   // For reading/writing the files
+#include <QDir>                    // For creating the folders
+#ifdef Q_OS_WIN
+#include <io.h>                    // For _commit
+#else
+#include <unistd.h>                // For fsync
+#endif
+
+// Hold the names of the index file, its lock file and of the objects folder inside the store folder
+const QString MatrixStore::INDEX_FILE_NAME = "index.txt";
+const QString MatrixStore::LOCK_FILE_NAME = "index.lock";
+const QString MatrixStore::OBJECTS_FOLDER_NAME = "objects";
+const int MatrixStore::LOCK_TIMEOUT = 5000;
+
+// Constructor to set the folder of the store. The index is read when it is first needed.
+// It has one input parameter: const QString &folder the name of the folder that holds the store
+MatrixStore::MatrixStore(const QString &folder)
+    : folderName(folder), isCompressed(false), indexReadSize(0), nextID(1), isInTransaction(false) {}
+
+// Method that saves a chain of matrices to the store.
+// It has three parameters: the matrices in the flat format, the rows/columns vector of the chain and a reference that
+// is set to false in case the chain was already saved. Matrices that are already stored are not written again.
+// The index is locked while the chain is added, so the id is unique even if another program saves at the same time.
+// Inside a transaction the chain is written as pending, so other programs don't find it until it is committed.
+// It returns the id of the chain or -1 in case it couldn't be saved
+int MatrixStore::saveChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols, bool &isNewChain) {
+    isNewChain = false;
+    if (matrices.isEmpty() || rowsCols.size() != matrices.size() + 1) return -1;
+
+    // Hash every matrix and the whole chain
+    QStringList matrixHashes;
+    for (int i = 0; i < matrices.size(); ++i) {
+        matrixHashes.append(hashMatrix(matrices[i], rowsCols[i], rowsCols[i + 1]));
+    }
+    QString chainHash = hashChain(matrixHashes);
+
+    QDir dir;
+    if (!dir.mkpath(folderName + "/" + OBJECTS_FOLDER_NAME)) return -1;
+    QLockFile lockFile(folderName + "/" + LOCK_FILE_NAME);
+    if (!lockFile.tryLock(LOCK_TIMEOUT)) return -1;
+
+    // Read what other programs appended and return the old id in case the chain is already saved and committed,
+    // or saved in the open transaction
+    readIndex(true);
+    if (chainIDs.contains(chainHash)) {
+        return chainIDs.value(chainHash);
+    }
+
+    // Write the matrices that aren't stored yet, before the index can point to them
+    for (int i = 0; i < matrices.size(); ++i) {
+        const QString &hash = matrixHashes[i];
+        if (hasObject(hash)) continue;
+
+        if (!writeObject(hash, matrices[i], rowsCols[i], rowsCols[i + 1])) return -1;
+        if (isInTransaction) {
+            txObjects.append(hash);
+        }
+    }
+
+    int chainID = nextID;
+    QByteArray line = QByteArray::number(chainID) + (isInTransaction ? " * " : " ") + chainHash.toLatin1() + " " +
+                      matrixHashes.join(" ").toLatin1() + "\n";
+    if (!appendIndex(line)) return -1;
+    if (isInTransaction) {
+        txChains.append(chainID);
+    }
+    readIndex(true);
+
+    isNewChain = true;
+    return chainID;
+}
+
+// Method that loads the chain with the given id from the store.
+// It returns the matrices and the rows/columns vector through the references and false if the chain couldn't be loaded,
+// chains that another program hasn't committed yet can't be loaded either
+bool MatrixStore::loadChain(int id, QVector<QVector<int>> &matrices, QVector<int> &rowsCols) {
+    readIndex(false);
+    if (!chainMatrices.contains(id) || pendingChains.contains(id)) return false;
+
+    QVector<QVector<int>> matricesTemp;
+    QVector<int> rowsColsTemp;
+    const QStringList &matrixHashes = chainMatrices[id];
+    for (const QString &hash : matrixHashes) {
+        QVector<int> matr;
+        int numRows, numCols;
+        if (!readObject(hash, matr, numRows, numCols)) return false;
+
+        // Every matrix must have as many rows as the previous matrix has columns
+        if (rowsColsTemp.isEmpty()) {
+            rowsColsTemp.append(numRows);
+        } else if (rowsColsTemp.last() != numRows) {
+            return false;
+        }
+        rowsColsTemp.append(numCols);
+        matricesTemp.append(matr);
+    }
+
+    matrices = matricesTemp;
+    rowsCols = rowsColsTemp;
+    return true;
+}
+
+// Finds the id of the chain with the given hash, it returns -1 if the chain isn't saved
+int MatrixStore::findChain(const QString &chainHash) {
+    readIndex(false);
+    return chainIDs.value(chainHash, -1);
+}
+
+// Getter for the path of the index file
+QString MatrixStore::getIndexPath() const {
+    return folderName + "/" + INDEX_FILE_NAME;
+}
+
+// Compress the matrix objects that are written from now on, objects that are already stored are read in both formats.
+// This is only available through the code, the program itself writes uncompressed objects.
+void MatrixStore::setCompression(bool isEnabled) {
+    isCompressed = isEnabled;
+}
+
+// Start a transaction, the chains saved from now on are pending until they are committed or undone
+void MatrixStore::beginTransaction() {
+    isInTransaction = true;
+    txChains.clear();
+    txObjects.clear();
+}
+
+// Keep all chains saved in the transaction by appending a commit line for each of them to the index,
+// from then on other programs find them and can load them.
+// It returns false if the index couldn't be locked or written, the transaction stays open in that case.
+bool MatrixStore::commit() {
+    if (!isInTransaction) return true;
+    if (!txChains.isEmpty()) {
+        QLockFile lockFile(folderName + "/" + LOCK_FILE_NAME);
+        if (!lockFile.tryLock(LOCK_TIMEOUT)) return false;
+        readIndex(true);
+
+        QByteArray lines;
+        for (int chainID : txChains) {
+            lines += QByteArray::number(chainID) + " +\n";
+        }
+        if (!appendIndex(lines)) return false;
+        readIndex(true);
+    }
+
+    endTransaction();
+    return true;
+}
+
+// Undo all chains saved in the transaction by appending a deletion line for each of them to the index, so the lines
+// other programs appended in the meantime are kept. The chains were pending, so no other program uses their ids.
+// The matrix objects written in the transaction are removed only if no remaining chain, pending or not, uses them.
+// It returns false if the index couldn't be locked or written, the transaction stays open in that case.
+bool MatrixStore::rollback() {
+    if (!isInTransaction) return true;
+    if (txChains.isEmpty()) {
+        endTransaction();
+        return true;
+    }
+
+    QLockFile lockFile(folderName + "/" + LOCK_FILE_NAME);
+    if (!lockFile.tryLock(LOCK_TIMEOUT)) return false;
+    readIndex(true);
+
+    QByteArray lines;
+    for (int chainID : txChains) {
+        lines += QByteArray::number(chainID) + " -\n";
+    }
+    if (!appendIndex(lines)) return false;
+    readIndex(true);
+
+    // Collect the objects that the remaining chains use
+    QSet<QString> usedObjects;
+    for (const QStringList &matrixHashes : chainMatrices) {
+        for (const QString &hash : matrixHashes) {
+            usedObjects.insert(hash);
+        }
+    }
+    for (const QString &hash : txObjects) {
+        if (!usedObjects.contains(hash)) {
+            QFile::remove(objectPath(hash, true));
+            QFile::remove(objectPath(hash, false));
+        }
+    }
+
+    endTransaction();
+    return true;
+}
+
+// Returns true if chains were saved in the open transaction
+bool MatrixStore::hasPendingChanges() const {
+    return isInTransaction && !txChains.isEmpty();
+}
+
+// Read the lines appended to the index file since the last read. A line holds the chain id, the chain hash and the
+// hashes of its matrices, with a "*" after the id while the chain is pending. A commit line holds the chain id and "+",
+// a deletion line the chain id and "-". A pending chain of another program is known, so its objects are kept,
+// but it isn't found by its hash until its commit line is read.
+// A program that stops without committing or undoing its transaction leaves its chains pending.
+// A last line without a new line is still being written or was torn by a crash, it is skipped. With the lock held
+// nobody else is writing, so it is cut off to let new lines be appended after the last complete one.
+void MatrixStore::readIndex(bool isLocked) {
+    QFile indexFile(getIndexPath());
+    if (!indexFile.open(QIODevice::ReadOnly)) return;
+    if (indexFile.size() < indexReadSize) {
+        // The index was replaced, read it again from the start
+        indexReadSize = 0;
+        nextID = 1;
+        chainIDs.clear();
+        chainMatrices.clear();
+        pendingChains.clear();
+    }
+    indexFile.seek(indexReadSize);
+    QByteArray data = indexFile.readAll();
+    indexFile.close();
+
+    int validSize = data.lastIndexOf('\n') + 1;  // Everything after the last new line is an unfinished append
+    if (isLocked && validSize < data.size()) {
+        QFile::resize(getIndexPath(), indexReadSize + validSize);
+    }
+    indexReadSize += validSize;
+
+    const QList<QByteArray> lines = data.left(validSize).split('\n');
+    for (const QByteArray &line : lines) {
+        QList<QByteArray> parts = line.trimmed().split(' ');
+        bool isOk;
+        int id = parts[0].toInt(&isOk);
+        if (!isOk) continue;
+        nextID = qMax(nextID, id + 1);
+
+        if (parts.size() == 2 && parts[1] == "-") {
+            // The chain was deleted
+            QString chainHash = hashChain(chainMatrices.value(id));
+            if (chainIDs.value(chainHash, -1) == id) {
+                chainIDs.remove(chainHash);
+            }
+            chainMatrices.remove(id);
+            pendingChains.remove(id);
+        } else if (parts.size() == 2 && parts[1] == "+") {
+            // The chain was committed, chains of this program are already findable
+            if (pendingChains.remove(id)) {
+                addChainID(hashChain(chainMatrices.value(id)), id);
+            }
+        } else if (parts.size() >= 3) {
+            bool isPending = parts[1] == "*";
+            int firstMatrix = isPending ? 3 : 2;
+            if (parts.size() <= firstMatrix) continue;
+
+            QStringList matrixHashes;
+            for (int i = firstMatrix; i < parts.size(); ++i) {
+                matrixHashes.append(QString::fromLatin1(parts[i]));
+            }
+            chainMatrices.insert(id, matrixHashes);
+
+            // A pending chain is only findable by the program whose transaction it belongs to
+            if (isPending && !txChains.contains(id)) {
+                pendingChains.insert(id);
+            } else {
+                addChainID(QString::fromLatin1(parts[firstMatrix - 1]), id);
+            }
+        }
+    }
+}
+
+// Map the chain hash to the id, unless it already maps to a committed chain. Two programs can save the same chain in
+// parallel transactions, the first one committed is then the one found.
+void MatrixStore::addChainID(const QString &chainHash, int id) {
+    if (!chainIDs.contains(chainHash) || txChains.contains(chainIDs.value(chainHash))) {
+        chainIDs.insert(chainHash, id);
+    }
+}
+
+// Close the transaction and forget the chains and objects saved in it
+void MatrixStore::endTransaction() {
+    isInTransaction = false;
+    txChains.clear();
+    txObjects.clear();
+}
+
+// Append complete lines to the index file with one write and flush them to the disk before returning,
+// so a line is either fully there after a crash or cut off as unfinished when the index is read again.
+// It returns false if the lines couldn't be written
+bool MatrixStore::appendIndex(const QByteArray &lines) {
+    QFile indexFile(getIndexPath());
+    if (!indexFile.open(QIODevice::WriteOnly | QIODevice::Append)) return false;
+    qint64 oldSize = indexFile.size();
+    if (indexFile.write(lines) != lines.size() || !indexFile.flush()) {
+        indexFile.close();
+        QFile::resize(getIndexPath(), oldSize);
+        return false;
+    }
+#ifdef Q_OS_WIN
+    bool isSynced = ::_commit(indexFile.handle()) == 0;
+#else
+    bool isSynced = ::fsync(indexFile.handle()) == 0;
+#endif
+    indexFile.close();
+    return isSynced;
+}
+
+// Write one matrix object in the same text format as the matrix files, compressed if compression is enabled.
+// The object is written to a temporary file and renamed, so a crash never leaves a partial object behind.
+bool MatrixStore::writeObject(const QString &hash, const QVector<int> &matr, int numRows, int numCols) {
+    QByteArray payload = QByteArray::number(numRows) + " " + QByteArray::number(numCols) + "\n";
+    for (int val : matr) {
+        payload += QByteArray::number(val) + " ";
+    }
+    payload += "\n";
+    if (isCompressed) {
+        payload = qCompress(payload, 1);  // Use the fastest level to keep the compression lightweight
+    }
+
+    QSaveFile file(objectPath(hash, isCompressed));
+    if (!file.open(QIODevice::WriteOnly)) return false;
+    file.write(payload);
+    return file.commit();
+}
+
+// Read one matrix object, it returns the values and the dimensions through the references and false on failure
+bool MatrixStore::readObject(const QString &hash, QVector<int> &matr, int &numRows, int &numCols) {
+    bool isCompressedObject = QFile::exists(objectPath(hash, true));
+    QFile file(objectPath(hash, isCompressedObject));
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    QByteArray payload = file.readAll();
+    file.close();
+    if (isCompressedObject) {
+        payload = qUncompress(payload);
+    }
+
+    QTextStream in(payload);
+    in >> numRows >> numCols;
+    if (in.status() != QTextStream::Ok || numRows < 1 || numCols < 1) return false;
+    matr.resize(numRows * numCols);
+    for (int i = 0; i < numRows * numCols; ++i) {
+        in >> matr[i];
+    }
+    return in.status() == QTextStream::Ok;
+}
+
+// Returns true if the matrix object with the given hash is stored in any format
+bool MatrixStore::hasObject(const QString &hash) const {
+    return QFile::exists(objectPath(hash, true)) || QFile::exists(objectPath(hash, false));
+}
+
+// Returns the path of the matrix object with the given hash
+QString MatrixStore::objectPath(const QString &hash, bool isCompressedObject) const {
+    return folderName + "/" + OBJECTS_FOLDER_NAME + "/" + hash + (isCompressedObject ? ".z" : ".txt");
+}
+
+// Hash the dimensions and the values of one matrix
+QString MatrixStore::hashMatrix(const QVector<int> &matr, int numRows, int numCols) {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(numRows) + " " + QByteArray::number(numCols) + "\n");
+    hash.addData(QByteArray::fromRawData(reinterpret_cast<const char *>(matr.constData()), matr.size() * sizeof(int)));
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+// Hash a chain from the hashes of its matrices
+QString MatrixStore::hashChain(const QStringList &matrixHashes) {
+    return QString::fromLatin1(QCryptographicHash::hash(matrixHashes.join(" ").toLatin1(), QCryptographicHash::Sha1).toHex());
+}
+
+// Hash a chain from its matrices and its rows/columns vector
+QString MatrixStore::hashChain(const QVector<QVector<int>> &matrices, const QVector<int> &rowsCols) {
+    QStringList matrixHashes;
+    for (int i = 0; i < matrices.size() && i + 1 < rowsCols.size(); ++i) {
+        matrixHashes.append(hashMatrix(matrices[i], rowsCols[i], rowsCols[i + 1]));
+    }
+    return hashChain(matrixHashes);
+}
@@ -0,0 +1,91 @@
+#include "matrixchaindistribute.h"
+#include "matrixchainsolve.h"
+#include <QCoreApplication>
+#include <cstdio>
+#include <sys/socket.h>
+
+// Socket transport that describes its worker end under its own scheme, so the worker process can only open it
+// through the worker transport registered for that scheme
+class CheckTransport : public UnixSocketTransport {
+public:
+    explicit CheckTransport(int fd) : UnixSocketTransport(fd) {}
+    QByteArray endpoint() const override {
+        return "check:" + UnixSocketTransport::endpoint().mid(5);
+    }
+    static bool createPair(std::unique_ptr<MatrixTransport> &masterEnd, std::unique_ptr<MatrixTransport> &workerEnd) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) return false;
+        masterEnd.reset(new CheckTransport(fds[0]));
+        workerEnd.reset(new CheckTransport(fds[1]));
+        return true;
+    }
+};
+
+// Solves the chain with 4 workers and compares it with the local result, it returns false if they differ
+static bool checkDistributed(const QVector<QVector<int>> &allMatrices, const QVector<int> &matrRowsCols,
+                             const QVector<QVector<int>> &expected, bool isCheckTransport) {
+    MatrixChainSolve distributedSolve;
+    distributedSolve.setMatrRowsCols(matrRowsCols);
+    distributedSolve.setAllMatrices(allMatrices);
+    MatrixChainDistribute distribute(&distributedSolve, 4);
+    distribute.setTileThreshold(100000);
+    distribute.setPanelWidth(16);
+    if (isCheckTransport) {
+        distribute.setTransportFactory(&CheckTransport::createPair);
+    }
+    QVector<QVector<int>> result = distribute.solveMatrices();
+
+    std::printf("%s transport, subtrees: %d, tiles: %d\n", isCheckTransport ? "check" : "unix",
+                distribute.getNumSubtrees(), distribute.getNumTiles());
+    if (!distribute.getLastError().isEmpty()) {
+        std::printf("error: %s\n", qPrintable(distribute.getLastError()));
+        return false;
+    }
+    if (distribute.getNumSubtrees() < 2 || distribute.getNumTiles() < 1) {
+        std::printf("the chain wasn't split into subtrees and tiles\n");
+        return false;
+    }
+    if (result != expected) {
+        std::printf("the distributed result doesn't match MatrixChainSolve::solveMatrices\n");
+        return false;
+    }
+    return true;
+}
+
+// Checks that MatrixChainDistribute computes the same result as MatrixChainSolve::solveMatrices
+// on a chain that is large enough to be split into subtrees and to have its top products tiled,
+// with the Unix socket transport and with a transport registered under another scheme.
+int main(int argc, char *argv[])
+{
+    // The workers run this executable again and open their end through the registered transports
+    MatrixChainDistribute::registerWorkerTransport("check", &UnixSocketTransport::open);
+    if (MatrixChainDistribute::isWorkerProcess(argc, argv)) {
+        return MatrixChainDistribute::runWorkerProcess(argv);
+    }
+    QCoreApplication app(argc, argv);
+
+    // Fill the chain with small deterministic values, so the result doesn't overflow
+    QVector<int> matrRowsCols{160, 20, 150, 30, 170, 25, 140, 35, 160};
+    QVector<QVector<int>> allMatrices;
+    unsigned int seed = 12345;
+    for (int m = 0; m + 1 < matrRowsCols.size(); ++m) {
+        QVector<int> matr(matrRowsCols[m] * matrRowsCols[m + 1]);
+        for (int &val : matr) {
+            seed = seed * 1103515245u + 12345u;
+            val = int((seed >> 16) % 5) - 2;
+        }
+        allMatrices.append(matr);
+    }
+
+    MatrixChainSolve localSolve;
+    localSolve.setMatrRowsCols(matrRowsCols);
+    localSolve.setAllMatrices(allMatrices);
+    QVector<QVector<int>> expected = localSolve.solveMatrices();
+
+    if (!checkDistributed(allMatrices, matrRowsCols, expected, false) ||
+        !checkDistributed(allMatrices, matrRowsCols, expected, true)) {
+        return 1;
+    }
+    std::printf("the distributed results match\n");
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "matrixchainlazy.h"
+#include "matrixchainsolve.h"
+#include <QCoreApplication>
+#include <cstdio>
+
+static int numFailed = 0;  // Number of the failed checks
+
+// Prints the description of a check that failed and counts it
+static void check(bool condition, const char *chain, const char *description) {
+    if (!condition) {
+        std::printf("failed for the %s chain: %s\n", chain, description);
+        ++numFailed;
+    }
+}
+
+// Fills a chain with the given rows/columns vector with small deterministic values
+static QVector<QVector<int>> makeChain(const QVector<int> &matrRowsCols, unsigned int seed) {
+    QVector<QVector<int>> allMatrices;
+    for (int m = 0; m + 1 < matrRowsCols.size(); ++m) {
+        QVector<int> matr(matrRowsCols[m] * matrRowsCols[m + 1]);
+        for (int &val : matr) {
+            seed = seed * 1103515245u + 12345u;
+            val = int((seed >> 16) % 7) - 3;
+        }
+        allMatrices.append(matr);
+    }
+    return allMatrices;
+}
+
+// Compares every query of MatrixChainLazy with the matching slice of the full result of MatrixChainSolve::solveMatrices.
+// It returns the minimal cost of the full chain.
+static int checkQueries(const QVector<int> &matrRowsCols, const char *chain) {
+    MatrixChainSolve solve;
+    solve.setMatrRowsCols(matrRowsCols);
+    solve.setAllMatrices(makeChain(matrRowsCols, 777));
+    MatrixChainLazy lazy(&solve);
+    QVector<QVector<int>> result = solve.solveMatrices();
+    int numRows = result.size();
+    int numCols = result[0].size();
+
+    check(lazy.getNumRows() == numRows && lazy.getNumCols() == numCols, chain, "the size of the result");
+
+    // Every row and every column
+    for (int r = 0; r < numRows; ++r) {
+        check(lazy.row(r) == result[r], chain, "a row matches the full result");
+    }
+    for (int c = 0; c < numCols; ++c) {
+        QVector<int> column;
+        for (int r = 0; r < numRows; ++r) {
+            column.append(result[r][c]);
+        }
+        check(lazy.col(c) == column, chain, "a column matches the full result");
+    }
+
+    // A block inside the result and the whole result as one block
+    int r0 = numRows / 3, c0 = numCols / 4;
+    int h = numRows - r0 - numRows / 4, w = numCols - c0 - numCols / 3;
+    QVector<QVector<int>> block;
+    for (int r = r0; r < r0 + h; ++r) {
+        block.append(result[r].mid(c0, w));
+    }
+    check(lazy.block(r0, c0, h, w) == block, chain, "a block matches the full result");
+    check(lazy.block(0, 0, numRows, numCols) == result, chain, "the whole block matches the full result");
+
+    // The product with a vector, which is appended to the chain as a matrix with one column
+    QVector<int> vect(numCols);
+    for (int c = 0; c < numCols; ++c) {
+        vect[c] = c % 5 - 2;
+    }
+    QVector<int> product(numRows, 0);
+    for (int r = 0; r < numRows; ++r) {
+        for (int c = 0; c < numCols; ++c) {
+            product[r] += result[r][c] * vect[c];
+        }
+    }
+    check(lazy.apply(vect) == product, chain, "the product with a vector matches the full result");
+
+    // Queries outside the result are empty
+    check(lazy.row(numRows).isEmpty() && lazy.col(-1).isEmpty(), chain, "a row or column out of range is empty");
+    check(lazy.block(r0, c0, numRows, w).isEmpty(), chain, "a block out of range is empty");
+    check(lazy.apply(QVector<int>(numCols + 1)).isEmpty(), chain, "a vector of the wrong size gives an empty product");
+
+    return solve.getCostMatr()[0][matrRowsCols.size() - 2];
+}
+
+// Checks the queries of MatrixChainLazy on a longer chain and on a chain of a single matrix,
+// and that a column or a product with a vector costs less than the full chain.
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QVector<int> matrRowsCols{30, 8, 25, 12, 40, 6, 35};
+    int fullCost = checkQueries(matrRowsCols, "long");
+    checkQueries(QVector<int>{9, 14}, "single matrix");
+
+    // The narrowed chains are planned again, so they are cheaper than the full chain
+    MatrixChainSolve solve;
+    solve.setMatrRowsCols(matrRowsCols);
+    solve.setAllMatrices(makeChain(matrRowsCols, 777));
+    MatrixChainLazy lazy(&solve);
+    lazy.apply(QVector<int>(matrRowsCols.last(), 1));
+    int applyCost = lazy.getLastCost();
+    lazy.col(0);
+    int colCost = lazy.getLastCost();
+    std::printf("full chain cost: %d, apply cost: %d, col cost: %d\n", fullCost, applyCost, colCost);
+    check(applyCost > 0 && applyCost < fullCost, "long", "the product with a vector costs less than the full chain");
+    check(colCost > 0 && colCost < fullCost, "long", "a column costs less than the full chain");
+
+    if (numFailed > 0) {
+        std::printf("%d lazy checks failed\n", numFailed);
+        return 1;
+    }
+    std::printf("all lazy checks passed\n");
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "matrixchainverify.h"
+#include "matrixchainsolve.h"
+#include <QCoreApplication>
+#include <cstdio>
+
+static int numFailed = 0;  // Number of the failed checks
+
+// Prints the description of a check that failed and counts it
+static void check(bool condition, const char *mode, const char *description) {
+    if (!condition) {
+        std::printf("failed in %s mode: %s\n", mode, description);
+        ++numFailed;
+    }
+}
+
+// Checks that every mode of MatrixChainVerify accepts the result of MatrixChainSolve::solveMatrices and rejects
+// the same result with one entry changed or with a wrong number of rows or columns.
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Fill the chain with small deterministic values
+    QVector<int> matrRowsCols{7, 12, 5, 9, 11, 6};
+    QVector<QVector<int>> allMatrices;
+    unsigned int seed = 2024;
+    for (int m = 0; m + 1 < matrRowsCols.size(); ++m) {
+        QVector<int> matr(matrRowsCols[m] * matrRowsCols[m + 1]);
+        for (int &val : matr) {
+            seed = seed * 1103515245u + 12345u;
+            val = int((seed >> 16) % 19) - 9;
+        }
+        allMatrices.append(matr);
+    }
+
+    MatrixChainSolve solve;
+    solve.setMatrRowsCols(matrRowsCols);
+    solve.setAllMatrices(allMatrices);
+    QVector<QVector<int>> result = solve.solveMatrices();
+
+    // The same result with one entry changed by one
+    QVector<QVector<int>> changedResult = result;
+    changedResult[3][2] += 1;
+    // The result without its last row and without its last column
+    QVector<QVector<int>> missingRow = result.mid(0, result.size() - 1);
+    QVector<QVector<int>> missingCol = result;
+    for (QVector<int> &row : missingCol) {
+        row.removeLast();
+    }
+
+    const MatrixChainVerify::Mode modes[] = {MatrixChainVerify::Exact, MatrixChainVerify::Modular, MatrixChainVerify::Tolerance};
+    const char *modeNames[] = {"exact", "modular", "tolerance"};
+    for (int i = 0; i < 3; ++i) {
+        MatrixChainVerify verify(modes[i]);
+        check(verify.verify(allMatrices, matrRowsCols, result), modeNames[i], "the solved result is accepted");
+        check(!verify.verify(allMatrices, matrRowsCols, changedResult), modeNames[i], "a changed entry is rejected");
+        check(!verify.verify(allMatrices, matrRowsCols, missingRow), modeNames[i], "a missing row is rejected");
+        check(!verify.verify(allMatrices, matrRowsCols, missingCol), modeNames[i], "a missing column is rejected");
+    }
+
+    // The default bound of 1e-9 needs 30 vectors that each let a wrong result pass with 1/2, and one modulo the prime
+    check(MatrixChainVerify(MatrixChainVerify::Exact).getNumTrials() == 30, "exact", "30 vectors for the default bound");
+    check(MatrixChainVerify(MatrixChainVerify::Modular).getNumTrials() == 1, "modular", "1 vector for the default bound");
+
+    if (numFailed > 0) {
+        std::printf("%d verify checks failed\n", numFailed);
+        return 1;
+    }
+    std::printf("all verify checks passed\n");
+    return 0;
+}
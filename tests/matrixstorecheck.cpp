@@ -0,0 +1,128 @@
+#include "matrixstore.h"
+#include <QCoreApplication>
+#include <QTemporaryDir>
+#include <QDir>
+#include <QFile>
+#include <cstdio>
+
+static int numFailed = 0;  // Number of the failed checks
+
+// Prints the description of a check that failed and counts it
+static void check(bool condition, const char *description) {
+    if (!condition) {
+        std::printf("failed: %s\n", description);
+        ++numFailed;
+    }
+}
+
+// Returns the number of files in the objects folder of the store with the given extension
+static int countObjects(const QString &folderName, const QString &extension) {
+    return QDir(folderName + "/objects").entryList(QStringList{"*" + extension}, QDir::Files).size();
+}
+
+// Checks the chain store: deduplication of a repeated chain, loading by id and by hash, undoing a transaction
+// while another store shares its matrices, skipping a torn last index line and compressed objects.
+// Every MatrixStore object stands for a separate running program that uses the same store folder.
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        std::printf("couldn't create a temporary folder\n");
+        return 1;
+    }
+    QString folderName = tempDir.path() + "/Matrices";
+
+    // The chains share their first matrix
+    QVector<QVector<int>> firstChain{{1, 2, 3, 4, 5, 6}, {7, 8, 9}};
+    QVector<int> firstRowsCols{2, 3, 1};
+    QVector<QVector<int>> secondChain{{1, 2, 3, 4, 5, 6}, {1, 0, 0, 1, 1, 1}};
+    QVector<int> secondRowsCols{2, 3, 2};
+    QVector<QVector<int>> thirdChain{{4, 3}, {2, 1, 0}};
+    QVector<int> thirdRowsCols{2, 1, 3};
+    QVector<QVector<int>> matrices;
+    QVector<int> rowsCols;
+    bool isNewChain = false;
+
+    // A repeated chain gets the id of the first save and no new objects
+    MatrixStore store(folderName);
+    int firstID = store.saveChain(firstChain, firstRowsCols, isNewChain);
+    check(firstID > 0 && isNewChain, "the first chain is saved");
+    int numObjects = countObjects(folderName, ".txt");
+    int repeatedID = store.saveChain(firstChain, firstRowsCols, isNewChain);
+    check(repeatedID == firstID && !isNewChain, "a repeated chain gets the id of the first save");
+    check(countObjects(folderName, ".txt") == numObjects, "a repeated chain writes no objects");
+
+    // Another program loads the chain by its id and finds it by its hash
+    MatrixStore otherStore(folderName);
+    check(otherStore.loadChain(firstID, matrices, rowsCols) && matrices == firstChain && rowsCols == firstRowsCols,
+          "the chain is loaded by its id");
+    check(otherStore.findChain(MatrixStore::hashChain(firstChain, firstRowsCols)) == firstID, "the chain is found by its hash");
+    check(otherStore.findChain(MatrixStore::hashChain(thirdChain, thirdRowsCols)) == -1, "an unsaved chain isn't found");
+    check(!otherStore.loadChain(firstID + 100, matrices, rowsCols), "an unknown id isn't loaded");
+
+    // A pending chain is only reused by the program that saved it, so undoing it can't take away a chain of another one
+    MatrixStore pendingStore(folderName);
+    pendingStore.beginTransaction();
+    int pendingID = pendingStore.saveChain(secondChain, secondRowsCols, isNewChain);
+    check(pendingID > 0 && isNewChain, "the second chain is saved in a transaction");
+    check(pendingStore.saveChain(secondChain, secondRowsCols, isNewChain) == pendingID && !isNewChain,
+          "the transaction reuses its own pending chain");
+    check(!otherStore.loadChain(pendingID, matrices, rowsCols), "a pending chain isn't loaded by another program");
+
+    otherStore.beginTransaction();
+    int parallelID = otherStore.saveChain(secondChain, secondRowsCols, isNewChain);
+    check(parallelID > 0 && parallelID != pendingID && isNewChain, "another program saves the pending chain again");
+
+    check(pendingStore.rollback(), "the transaction is undone");
+    check(!pendingStore.loadChain(pendingID, matrices, rowsCols), "the undone chain is gone");
+    check(otherStore.commit(), "the parallel transaction is committed");
+    check(pendingStore.loadChain(parallelID, matrices, rowsCols) && matrices == secondChain,
+          "the parallel chain keeps its matrices");
+    check(pendingStore.loadChain(firstID, matrices, rowsCols) && matrices == firstChain,
+          "the undo keeps the shared matrix of the first chain");
+    check(pendingStore.findChain(MatrixStore::hashChain(secondChain, secondRowsCols)) == parallelID,
+          "the committed parallel chain is found by its hash");
+
+    // Undoing a transaction removes only the objects no other chain uses
+    numObjects = countObjects(folderName, ".txt");
+    pendingStore.beginTransaction();
+    QVector<QVector<int>> sharedChain{firstChain[0], {1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    QVector<int> sharedRowsCols{2, 3, 3};
+    pendingStore.saveChain(sharedChain, sharedRowsCols, isNewChain);
+    check(countObjects(folderName, ".txt") == numObjects + 1, "only the new matrix of the chain is written");
+    check(pendingStore.rollback(), "the second transaction is undone");
+    check(countObjects(folderName, ".txt") == numObjects, "the undo removes only the new matrix");
+    check(store.loadChain(firstID, matrices, rowsCols) && matrices == firstChain, "the shared matrix is still loaded");
+
+    // A last line without a new line was torn by a crash, it is skipped and cut off before the next append
+    QFile indexFile(folderName + "/index.txt");
+    if (indexFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        indexFile.write("999 0123456789abcdef");
+        indexFile.close();
+    }
+    MatrixStore tornStore(folderName);
+    check(!tornStore.loadChain(999, matrices, rowsCols), "the torn line is skipped");
+    int thirdID = tornStore.saveChain(thirdChain, thirdRowsCols, isNewChain);
+    check(thirdID > 0 && thirdID < 999 && isNewChain, "the next id ignores the torn line");
+    MatrixStore freshStore(folderName);
+    check(freshStore.loadChain(thirdID, matrices, rowsCols) && matrices == thirdChain && rowsCols == thirdRowsCols,
+          "the chain saved after the torn line is loaded");
+
+    // Compressed objects are read back like the uncompressed ones
+    MatrixStore compressedStore(folderName);
+    compressedStore.setCompression(true);
+    QVector<QVector<int>> compressedChain{{-5, 0, 12, 7}, {3, -3}};
+    QVector<int> compressedRowsCols{2, 2, 1};
+    int compressedID = compressedStore.saveChain(compressedChain, compressedRowsCols, isNewChain);
+    check(compressedID > 0 && isNewChain && countObjects(folderName, ".z") == 2, "the new matrices are written compressed");
+    check(freshStore.loadChain(compressedID, matrices, rowsCols) && matrices == compressedChain &&
+          rowsCols == compressedRowsCols, "the compressed chain is loaded");
+
+    if (numFailed > 0) {
+        std::printf("%d store checks failed\n", numFailed);
+        return 1;
+    }
+    std::printf("all store checks passed\n");
+    return 0;
+}